@@ -26,6 +26,8 @@
 // Global Structures
 //=======================================================================================
 
+class SkUEMethodCache;
+
 //---------------------------------------------------------------------------------------
 // Adds SkookumScript text-based scripting capabilities to an actor.
 UCLASS(classGroup=Scripting, editinlinenew, BlueprintType, meta=(BlueprintSpawnableComponent), hideCategories=(Object, ActorComponent), EarlyAccessPreview)
@@ -73,13 +75,26 @@ class SKOOKUMSCRIPTRUNTIME_API USkookumScriptComponent : public UActorComponent
       virtual void UninitializeComponent() override;
       virtual void OnUnregister() override;
 
+    // Begin UObject interface
+
+      virtual void BeginDestroy() override;
+
   protected:
 
+  // Internal Methods
+
+    SkMethodBase * find_method(const FString & name);
+    void           invoke_method_direct(SkMethodBase * method_p, SkInstance ** result_pp);
+
   // Internal Data Members
 
     // Keep the SkookumScript instance belonging to this actor around
     AIdPtr<SkInstance> m_instance_p;
 
+    // Inline cache of the last few methods invoked by name on this component - created on
+    // first use
+    SkUEMethodCache * m_method_cache_p;
+
   };  // USkookumScriptComponent
 
 
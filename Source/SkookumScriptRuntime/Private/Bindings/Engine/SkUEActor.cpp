@@ -266,24 +266,26 @@ namespace SkUEActor_Impl
     SkClosure * closure_p = scope_p->get_arg_data<SkClosure>(SkArg_1);
     uint32_t num_arguments = listener_p->get_num_arguments();
     bool exit = false;
-    SkInstance * closure_result_p = SkBrain::ms_nil_p;
-    SkInstance * return_value_p = SkBrain::ms_nil_p;
     do
       {
       // Use event parameters to invoke closure, then recycle event
       USkookumScriptListener::EventInfo * event_p = listener_p->pop_event();
-      if (do_until)
+      if (!do_until)
+        {
+        // Result is not needed so don't have one made
+        closure_p->closure_method_call(&event_p->m_argument_p[0], num_arguments, nullptr, scope_p);
+        }
+      else
         {
         // Add reference to potential return values so they survive closure_method_call 
         for (uint32_t i = 0; i < num_arguments; ++i)
           {
           event_p->m_argument_p[SkArg_1 + i]->reference();
           }
-        }
-      closure_p->closure_method_call(&event_p->m_argument_p[0], listener_p->get_num_arguments(), &closure_result_p, scope_p);
-      if (do_until)
-        {
-        exit = closure_result_p->as<SkBoolean>();        
+        SkInstance * closure_result_p = SkBrain::ms_nil_p;
+        closure_p->closure_method_call(&event_p->m_argument_p[0], num_arguments, &closure_result_p, scope_p);
+        exit = closure_result_p->as<SkBoolean>();
+        closure_result_p->dereference();
         for (uint32_t i = 0; i < num_arguments; ++i)
           {
           if (exit)
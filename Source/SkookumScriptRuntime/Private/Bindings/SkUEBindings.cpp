@@ -22,6 +22,9 @@
 #include "VectorMath/SkRotationAngles.hpp"
 #include "VectorMath/SkTransform.hpp"
 #include "VectorMath/SkColor.hpp"
+#include "VectorMath/SkFloatArray.hpp"
+#include "VectorMath/SkIntArray.hpp"
+#include "VectorMath/SkVector3Array.hpp"
 
 #include "Engine/SkUEName.hpp"
 #include "Engine/SkUEActor.hpp"
@@ -50,6 +53,9 @@ void SkUEBindings::register_all()
   SkRotationAngles::register_bindings();
   SkTransform::register_bindings();
   SkColor::register_bindings();
+  SkFloatArray::register_bindings();
+  SkIntArray::register_bindings();
+  SkVector3Array::register_bindings();
 
   // Engine-Generated Overlay
   SkUE::register_bindings();
@@ -43,13 +43,16 @@ SkUEBlueprintInterface::~SkUEBlueprintInterface()
 void SkUEBlueprintInterface::clear()
   {
   // Destroy all UFunctions and UProperties we allocated
-  for (uint32_t i = 0; i < m_method_entry_array.get_length(); ++i)
+  TArray<UClass *> ue_classes;
+  m_class_entry_indices.GetKeys(ue_classes);
+  for (UClass * ue_class_p : ue_classes)
     {
-    delete_method_entry(i);
+    delete_class_method_entries(ue_class_p);
     }
 
   // And forget pointers to them 
   m_method_entry_array.empty();
+  m_free_entry_indices.Reset();
   }
 
 //---------------------------------------------------------------------------------------
@@ -62,15 +65,8 @@ UClass * SkUEBlueprintInterface::reinitialize_class(SkClass * sk_class_p)
   // Can only reinitialize if this class has a mapping to UE
   if (ue_class_p)
     {
-    // Find existing methods of this class and delete them
-    for (uint32_t i = 0; i < m_method_entry_array.get_length(); ++i)
-      {
-      SK_ASSERTX(m_method_entry_array[i]->m_ue_method_p.IsValid(), "Encountered invalid method pointer."); // If this is a problem, store and use sk_class_p instead
-      if (m_method_entry_array[i]->m_ue_method_p->GetOuter() == ue_class_p)
-        {
-        delete_method_entry(i);
-        }
-      }
+    // Delete existing methods of this class
+    delete_class_method_entries(ue_class_p);
 
     // Gather new methods
     for (auto method_p : sk_class_p->get_instance_methods())
@@ -118,11 +114,30 @@ void SkUEBlueprintInterface::reinitialize_all()
   reinitialize_class_recursively(SkUEActor::ms_class_p);
   }
 
+//---------------------------------------------------------------------------------------
+// Determines if any method of the given class or its subclasses is currently exported to
+// Blueprints - such methods must stay around as long as their UFunctions refer to them.
+bool SkUEBlueprintInterface::has_method_entries_of(SkClass * sk_class_p) const
+  {
+  // All entries filed under a UClass come from the same SkClass so checking the first
+  // entry of each UClass is enough
+  for (auto iter = m_class_entry_indices.CreateConstIterator(); iter; ++iter)
+    {
+    const TArray<uint32_t> & entry_indices = iter.Value();
+    if (entry_indices.Num() && m_method_entry_array[entry_indices[0]]->m_sk_method_p->get_scope()->is_class(*sk_class_p))
+      {
+      return true;
+      }
+    }
+
+  return false;
+  }
+
 //---------------------------------------------------------------------------------------
 
 void SkUEBlueprintInterface::exec_method(FFrame & stack, void * const result_p, SkInstance * this_p)
   {
-  const MethodEntry & method_entry = *ms_singleton_p->m_method_entry_array[stack.CurrentNativeFunction->RepOffset];
+  MethodEntry & method_entry = *ms_singleton_p->m_method_entry_array[stack.CurrentNativeFunction->RepOffset];
 
   SkInvokedMethod * imethod_p = SkInvokedMethod::pool_new(nullptr, this_p, method_entry.m_sk_method_p);
 
@@ -130,12 +145,12 @@ void SkUEBlueprintInterface::exec_method(FFrame & stack, void * const result_p,
   SKDEBUG_HOOK_SCRIPT_ENTRY(method_entry.m_sk_method_p->get_name());
 
   // Fill invoked method's argument list
-  const ParamEntry * param_entry_array = method_entry.get_param_entry_array();
+  ParamEntry * param_entry_array = method_entry.get_param_entry_array();
   imethod_p->data_ensure_size(method_entry.m_num_params);
   for (uint32_t i = 0; i < method_entry.m_num_params; ++i)
     {
-    const ParamEntry & param_entry = param_entry_array[i];
-    imethod_p->data_append_arg(param_entry.m_name, (*param_entry.m_fetcher_p)(stack));
+    ParamEntry & param_entry = param_entry_array[i];
+    imethod_p->data_append_arg(param_entry.m_name, fetch_arg(&param_entry, stack));
     }
 
   // Done with stack - now increment the code ptr unless it is null
@@ -148,6 +163,7 @@ void SkUEBlueprintInterface::exec_method(FFrame & stack, void * const result_p,
     {
     (*method_entry.m_result_setter_p)(result_p, result_instance_p);
     }
+  result_instance_p->dereference();
 
   SKDEBUG_HOOK_SCRIPT_EXIT();
 
@@ -232,24 +248,24 @@ int32_t SkUEBlueprintInterface::add_method_entry(UClass * ue_class_p, SkMethodBa
     ParamEntry & param_entry = method_entry_p->get_param_entry_array()[i];
     param_entry.m_name = input_param->get_name();
     param_entry.m_fetcher_p = param_info.m_param_fetcher_p;
+    param_entry.m_refetcher_p = param_info.m_param_refetcher_p;
     }
 
   // Store method entry in array
-  // Look if there is an empty slot that we can reuse
+  // Reuse an empty slot if there is one
   int32_t method_index;
-  for (method_index = 0; method_index < (int32_t)m_method_entry_array.get_length(); ++method_index)
-    {
-    if (!m_method_entry_array[method_index]) break;
-    }
-  ue_method_p->RepOffset = uint16(method_index); // Remember array index of method to call
-  if (method_index == m_method_entry_array.get_length())
+  if (m_free_entry_indices.Num())
     {
-    m_method_entry_array.append(*method_entry_p);
+    method_index = m_free_entry_indices.Pop(false);
+    m_method_entry_array.set_at(method_index, method_entry_p);
     }
   else
     {
-    m_method_entry_array.set_at(method_index, method_entry_p);
+    method_index = m_method_entry_array.get_length();
+    m_method_entry_array.append(*method_entry_p);
     }
+  ue_method_p->RepOffset = uint16(method_index); // Remember array index of method to call
+  m_class_entry_indices.FindOrAdd(ue_class_p).Add(method_index);
 
   // Make method known to its class
   ue_class_p->LinkChild(ue_method_p);
@@ -259,32 +275,57 @@ int32_t SkUEBlueprintInterface::add_method_entry(UClass * ue_class_p, SkMethodBa
   }
 
 //---------------------------------------------------------------------------------------
-// Delete method entry and set pointer to nullptr so it can be reused
+// Delete all method entries exported to the given class and set their pointers to nullptr
+// so the slots can be reused
 
-void SkUEBlueprintInterface::delete_method_entry(uint32_t method_index)
+void SkUEBlueprintInterface::delete_class_method_entries(UClass * ue_class_p)
   {
-  MethodEntry * method_entry_p = m_method_entry_array[method_index];
-  if (method_entry_p->m_ue_method_p.IsValid())
+  TArray<uint32_t> entry_indices;
+  if (!m_class_entry_indices.RemoveAndCopyValue(ue_class_p, entry_indices))
     {
-    UFunction * ue_method_p = method_entry_p->m_ue_method_p.Get();
-    UClass * ue_class_p = ue_method_p->GetOwnerClass();
-    // Unlink from its owner class
-    ue_class_p->RemoveFunctionFromFunctionMap(ue_method_p);
-    // Unlink from the Children list as well
+    return;
+    }
+
+  TSet<UField *> ue_methods;
+  ue_methods.Reserve(entry_indices.Num());
+  for (uint32_t method_index : entry_indices)
+    {
+    MethodEntry * method_entry_p = m_method_entry_array[method_index];
+    if (method_entry_p->m_ue_method_p.IsValid())
+      {
+      UFunction * ue_method_p = method_entry_p->m_ue_method_p.Get();
+      SK_ASSERTX(ue_method_p->GetOwnerClass() == ue_class_p, "Method entry is filed under the wrong class.");
+      // Unlink from its owner class
+      ue_class_p->RemoveFunctionFromFunctionMap(ue_method_p);
+      ue_methods.Add(ue_method_p);
+      }
+    delete method_entry_p;
+    m_method_entry_array.set_at(method_index, nullptr);
+    m_free_entry_indices.Add(method_index);
+    }
+
+  if (ue_methods.Num())
+    {
+    // Unlink from the Children list as well - all in one pass
     UField ** prev_field_pp = &ue_class_p->Children;
-    for (UField * field_p = *prev_field_pp; field_p; prev_field_pp = &field_p->Next, field_p = *prev_field_pp)
+    for (UField * field_p = *prev_field_pp; field_p; field_p = *prev_field_pp)
       {
-      if (field_p == ue_method_p)
+      if (ue_methods.Contains(field_p))
         {
         *prev_field_pp = field_p->Next;
-        break;
+        }
+      else
+        {
+        prev_field_pp = &field_p->Next;
         }
       }
-    // Destroy the function along with its attached properties
-    ue_method_p->ConditionalBeginDestroy();
+
+    // Destroy the functions along with their attached properties
+    for (UField * field_p : ue_methods)
+      {
+      field_p->ConditionalBeginDestroy();
+      }
     }
-  delete method_entry_p;
-  m_method_entry_array.set_at(method_index, nullptr);
   }
 
 //---------------------------------------------------------------------------------------
@@ -295,23 +336,27 @@ bool SkUEBlueprintInterface::make_param(ParamInfo * out_param_info_p, UFunction
   // Based on Sk type, figure out the matching UProperty as well as fetcher and setter methods
   UProperty * property_p = nullptr;
   tParamFetcher param_fetcher_p = nullptr;
+  tParamRefetcher param_refetcher_p = nullptr;
   tResultSetter result_setter_p = nullptr;
   if (sk_parameter_class_p == SkBoolean::ms_class_p)
     {
     property_p = NewObject<UBoolProperty>(ue_method_p, param_name, RF_Public);
     param_fetcher_p = &fetch_param_boolean;
+    param_refetcher_p = &refetch_param_boolean;
     result_setter_p = &set_result_boolean;
     }
   else if (sk_parameter_class_p == SkInteger::ms_class_p)
     {
     property_p = NewObject<UIntProperty>(ue_method_p, param_name, RF_Public);
     param_fetcher_p = &fetch_param_integer;
+    param_refetcher_p = &refetch_param_integer;
     result_setter_p = &set_result_integer;
     }
   else if (sk_parameter_class_p == SkReal::ms_class_p)
     {
     property_p = NewObject<UFloatProperty>(ue_method_p, param_name, RF_Public);
     param_fetcher_p = &fetch_param_real;
+    param_refetcher_p = &refetch_param_real;
     result_setter_p = &set_result_real;
     }
   else if (sk_parameter_class_p == SkString::ms_class_p)
@@ -326,6 +371,7 @@ bool SkUEBlueprintInterface::make_param(ParamInfo * out_param_info_p, UFunction
     struct_property_p->Struct = NewObject<UScriptStruct>(property_p, "Vector", RF_Public);
     property_p = struct_property_p;
     param_fetcher_p = &fetch_param_vector3;
+    param_refetcher_p = &refetch_param_vector3;
     result_setter_p = &set_result_vector3;
     }
   else if (sk_parameter_class_p == SkRotationAngles::ms_class_p)
@@ -334,6 +380,7 @@ bool SkUEBlueprintInterface::make_param(ParamInfo * out_param_info_p, UFunction
     struct_property_p->Struct = NewObject<UScriptStruct>(property_p, "Rotator", RF_Public);
     property_p = struct_property_p;
     param_fetcher_p = &fetch_param_rotation_angles;
+    param_refetcher_p = &refetch_param_rotation_angles;
     result_setter_p = &set_result_rotation_angles;
     }
   else if (sk_parameter_class_p == SkTransform::ms_class_p)
@@ -342,6 +389,7 @@ bool SkUEBlueprintInterface::make_param(ParamInfo * out_param_info_p, UFunction
     struct_property_p->Struct = NewObject<UScriptStruct>(property_p, "Transform", RF_Public);
     property_p = struct_property_p;
     param_fetcher_p = &fetch_param_transform;
+    param_refetcher_p = &refetch_param_transform;
     result_setter_p = &set_result_transform;
     }
   else if (sk_parameter_class_p->get_key_class()->is_class(*SkUEEntity::ms_class_p))
@@ -369,12 +417,47 @@ bool SkUEBlueprintInterface::make_param(ParamInfo * out_param_info_p, UFunction
   // Set result
   out_param_info_p->m_ue_param_p = property_p;
   out_param_info_p->m_param_fetcher_p = param_fetcher_p;
+  out_param_info_p->m_param_refetcher_p = param_refetcher_p;
   out_param_info_p->m_result_setter_p = result_setter_p;
 
   // Successful?
   return property_p != nullptr;
   }
 
+//---------------------------------------------------------------------------------------
+// Fetch the argument for a parameter from the Blueprint stack
+// Boolean, Integer, Real and struct parameters reuse the instance passed on the previous
+// call if nothing else holds on to it anymore, so steady-state calls do not allocate
+
+SkInstance * SkUEBlueprintInterface::fetch_arg(ParamEntry * param_entry_p, FFrame & stack)
+  {
+  if (!param_entry_p->m_refetcher_p)
+    {
+    return (*param_entry_p->m_fetcher_p)(stack);
+    }
+
+  SkInstance * arg_p = param_entry_p->m_arg_cache_p;
+  if (arg_p && arg_p->get_references() == 1u)
+    {
+    // Only the cache refers to it - overwrite in place
+    (*param_entry_p->m_refetcher_p)(stack, arg_p);
+    }
+  else
+    {
+    // Kept by script or still in use further up the call stack - replace with a new one
+    if (arg_p)
+      {
+      arg_p->dereference();
+      }
+    arg_p = (*param_entry_p->m_fetcher_p)(stack);
+    param_entry_p->m_arg_cache_p = arg_p;
+    }
+
+  // One reference for the cache, one for the invoked method
+  arg_p->reference();
+  return arg_p;
+  }
+
 //---------------------------------------------------------------------------------------
 
 SkInstance * SkUEBlueprintInterface::fetch_param_boolean(FFrame & stack)
@@ -415,27 +498,27 @@ SkInstance * SkUEBlueprintInterface::fetch_param_string(FFrame & stack)
 
 SkInstance * SkUEBlueprintInterface::fetch_param_vector3(FFrame & stack)
   {
-  FVector value(ForceInitToZero);
-  stack.StepCompiledIn<UStructProperty>(&value);
-  return SkVector3::new_instance(value);
+  SkInstance * instance_p = SkVector3::new_instance(ForceInitToZero);
+  refetch_param_vector3(stack, instance_p);
+  return instance_p;
   }
 
 //---------------------------------------------------------------------------------------
 
 SkInstance * SkUEBlueprintInterface::fetch_param_rotation_angles(FFrame & stack)
   {
-  FRotator value(ForceInitToZero);
-  stack.StepCompiledIn<UStructProperty>(&value);
-  return SkRotationAngles::new_instance(value);
+  SkInstance * instance_p = SkRotationAngles::new_instance(ForceInitToZero);
+  refetch_param_rotation_angles(stack, instance_p);
+  return instance_p;
   }
 
 //---------------------------------------------------------------------------------------
 
 SkInstance * SkUEBlueprintInterface::fetch_param_transform(FFrame & stack)
   {
-  FTransform value;
-  stack.StepCompiledIn<UStructProperty>(&value);
-  return SkTransform::new_instance(value);
+  SkInstance * instance_p = SkTransform::new_instance();
+  refetch_param_transform(stack, instance_p);
+  return instance_p;
   }
 
 //---------------------------------------------------------------------------------------
@@ -447,6 +530,56 @@ SkInstance * SkUEBlueprintInterface::fetch_param_entity(FFrame & stack)
   return SkUEEntity::new_instance(obj_p);
   }
 
+//---------------------------------------------------------------------------------------
+// Store parameters into the user data of an existing instance
+
+void SkUEBlueprintInterface::refetch_param_boolean(FFrame & stack, SkInstance * arg_p)
+  {
+  UBoolProperty::TCppType value = UBoolProperty::GetDefaultPropertyValue();
+  stack.StepCompiledIn<UBoolProperty>(&value);
+  arg_p->as<SkBoolean>() = value;
+  }
+
+//---------------------------------------------------------------------------------------
+
+void SkUEBlueprintInterface::refetch_param_integer(FFrame & stack, SkInstance * arg_p)
+  {
+  UIntProperty::TCppType value = UIntProperty::GetDefaultPropertyValue();
+  stack.StepCompiledIn<UIntProperty>(&value);
+  arg_p->as<SkInteger>() = value;
+  }
+
+//---------------------------------------------------------------------------------------
+
+void SkUEBlueprintInterface::refetch_param_real(FFrame & stack, SkInstance * arg_p)
+  {
+  UFloatProperty::TCppType value = UFloatProperty::GetDefaultPropertyValue();
+  stack.StepCompiledIn<UFloatProperty>(&value);
+  arg_p->as<SkReal>() = value;
+  }
+
+//---------------------------------------------------------------------------------------
+// Struct parameters can be stepped straight into the user data
+
+void SkUEBlueprintInterface::refetch_param_vector3(FFrame & stack, SkInstance * arg_p)
+  {
+  stack.StepCompiledIn<UStructProperty>(&arg_p->as<SkVector3>());
+  }
+
+//---------------------------------------------------------------------------------------
+
+void SkUEBlueprintInterface::refetch_param_rotation_angles(FFrame & stack, SkInstance * arg_p)
+  {
+  stack.StepCompiledIn<UStructProperty>(&arg_p->as<SkRotationAngles>());
+  }
+
+//---------------------------------------------------------------------------------------
+
+void SkUEBlueprintInterface::refetch_param_transform(FFrame & stack, SkInstance * arg_p)
+  {
+  stack.StepCompiledIn<UStructProperty>(&arg_p->as<SkTransform>());
+  }
+
 //---------------------------------------------------------------------------------------
 
 void SkUEBlueprintInterface::set_result_boolean(void * const result_p, SkInstance * value_p)
@@ -28,16 +28,22 @@ class SkUEBlueprintInterface
     UClass *  reinitialize_class(SkClass * sk_class_p);
     void      reinitialize_class_recursively(SkClass * sk_class_p);
     void      reinitialize_all(); // Gather methods from SkookumScript
+    bool      has_method_entries_of(SkClass * sk_class_p) const; // If any methods of this class or its subclasses are exported
 
   protected:
 
     typedef SkInstance *  (*tParamFetcher)(FFrame & stack);
+    typedef void          (*tParamRefetcher)(FFrame & stack, SkInstance * arg_p);
     typedef void          (*tResultSetter)(void * const result_p, SkInstance * value_p);
 
     struct ParamEntry
       {
-      ASymbol       m_name;
-      tParamFetcher m_fetcher_p;
+      ASymbol         m_name;
+      tParamFetcher   m_fetcher_p;
+      tParamRefetcher m_refetcher_p;  // If set, can store the parameter value into an existing instance
+      SkInstance *    m_arg_cache_p;  // Argument instance of the previous call that m_refetcher_p may reuse
+
+      ParamEntry() : m_fetcher_p(nullptr), m_refetcher_p(nullptr), m_arg_cache_p(nullptr) {}
       };
 
     struct MethodEntry
@@ -52,7 +58,26 @@ class SkUEBlueprintInterface
         , m_ue_method_p(ue_method_p)
         , m_num_params(num_params)
         , m_result_setter_p(result_setter_p)
-        {}
+        {
+        ParamEntry * param_entry_array = get_param_entry_array();
+        for (uint32_t i = 0; i < num_params; ++i)
+          {
+          new(&param_entry_array[i]) ParamEntry();
+          }
+        }
+
+      ~MethodEntry()
+        {
+        // Release argument instances kept around for reuse
+        ParamEntry * param_entry_array = get_param_entry_array();
+        for (uint32_t i = 0; i < m_num_params; ++i)
+          {
+          if (param_entry_array[i].m_arg_cache_p)
+            {
+            param_entry_array[i].m_arg_cache_p->dereference();
+            }
+          }
+        }
 
       // The parameter entries are stored behind this structure in memory
       ParamEntry *       get_param_entry_array()       { return (ParamEntry *)(this + 1); }
@@ -63,6 +88,7 @@ class SkUEBlueprintInterface
       {
       UProperty *     m_ue_param_p;
       tParamFetcher   m_param_fetcher_p;
+      tParamRefetcher m_param_refetcher_p;
       tResultSetter   m_result_setter_p;
       };
 
@@ -71,8 +97,9 @@ class SkUEBlueprintInterface
     void                exec_instance_method(FFrame & stack, void * const result_p);
 
     int32_t             add_method_entry(UClass * ue_class_p, SkMethodBase * sk_method_p, const FString & category);
-    void                delete_method_entry(uint32_t method_index);
+    void                delete_class_method_entries(UClass * ue_class_p);
     static bool         make_param(ParamInfo * out_param_info_p, UFunction * ue_method_p, SkClassDescBase * sk_parameter_class_p, const FName & param_name);
+    static SkInstance * fetch_arg(ParamEntry * param_entry_p, FFrame & stack);
 
     static SkInstance * fetch_param_boolean(FFrame & stack);
     static SkInstance * fetch_param_integer(FFrame & stack);
@@ -83,6 +110,13 @@ class SkUEBlueprintInterface
     static SkInstance * fetch_param_transform(FFrame & stack);
     static SkInstance * fetch_param_entity(FFrame & stack);
 
+    static void         refetch_param_boolean(FFrame & stack, SkInstance * arg_p);
+    static void         refetch_param_integer(FFrame & stack, SkInstance * arg_p);
+    static void         refetch_param_real(FFrame & stack, SkInstance * arg_p);
+    static void         refetch_param_vector3(FFrame & stack, SkInstance * arg_p);
+    static void         refetch_param_rotation_angles(FFrame & stack, SkInstance * arg_p);
+    static void         refetch_param_transform(FFrame & stack, SkInstance * arg_p);
+
     static void         set_result_boolean(void * const result_p, SkInstance * value_p);
     static void         set_result_integer(void * const result_p, SkInstance * value_p);
     static void         set_result_real(void * const result_p, SkInstance * value_p);
@@ -92,7 +126,9 @@ class SkUEBlueprintInterface
     static void         set_result_transform(void * const result_p, SkInstance * value_p);
     static void         set_result_entity(void * const result_p, SkInstance * value_p);
 
-    APArray<MethodEntry>            m_method_entry_array;
-    static SkUEBlueprintInterface * ms_singleton_p; // Hack, make it easy to access for callbacks
+    APArray<MethodEntry>              m_method_entry_array;
+    TArray<uint32_t>                  m_free_entry_indices;  // Slots in m_method_entry_array that are nullptr and can be reused
+    TMap<UClass *, TArray<uint32_t>>  m_class_entry_indices; // Indices into m_method_entry_array of the entries belonging to each UClass
+    static SkUEBlueprintInterface *   ms_singleton_p; // Hack, make it easy to access for callbacks
         
   };
\ No newline at end of file
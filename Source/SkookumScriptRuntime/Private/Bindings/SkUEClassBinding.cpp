@@ -9,6 +9,7 @@
 
 #include "../SkookumScriptRuntimePrivatePCH.h"
 #include "SkUEClassBinding.hpp"
+#include "SkUERuntime.hpp"
 #include "../Classes/SkookumScriptComponent.h"
 #include <SkUEWorld.generated.hpp>
 
@@ -18,20 +19,34 @@ TMap<UClass*, SkClass*>                         SkUEClassBindingHelper::ms_stati
 TMap<SkClassDescBase*, UClass*>                 SkUEClassBindingHelper::ms_static_class_map_s2u;
 TMap<SkClassDescBase*, TWeakObjectPtr<UClass>>  SkUEClassBindingHelper::ms_dynamic_class_map_s2u;
 TMap<UClass*, SkClass*>                         SkUEClassBindingHelper::ms_dynamic_class_map_u2s;
+TMap<SkClass*, SkUEClassBindingHelper::tMethodMap> SkUEClassBindingHelper::ms_method_cache;
+uint32_t                                        SkUEClassBindingHelper::ms_method_epoch = 1u;
+SkTypedData *                                   SkUEClassBindingHelper::ms_world_var_p = nullptr;
 
 //---------------------------------------------------------------------------------------
 // Get pointer to UWorld from global variable
 UWorld * SkUEClassBindingHelper::get_world()
   {
-  static SkTypedData * world_var_p = nullptr;
-  if (!world_var_p)
+  SkTypedData * world_var_p = get_world_var();
+
+  SK_ASSERTX(world_var_p->m_data_p && (world_var_p->m_data_p == SkBrain::ms_nil_p || world_var_p->m_data_p->get_class() == SkBrain::get_class(ASymbol_World)), "@@world variable does not have proper type."); // nil is ok
+  return world_var_p->m_data_p == SkBrain::ms_nil_p ? nullptr : world_var_p->m_data_p->as<SkUEWorld>();
+  }
+
+//---------------------------------------------------------------------------------------
+// Get the @@world class data member of Object.
+// Class data is kept sorted by name, so rather than searching for it on each access it
+// is looked up once and the resolved member is kept until reset_class_data_vars().
+SkTypedData * SkUEClassBindingHelper::get_world_var()
+  {
+  if (!ms_world_var_p)
     {
     SkClass * obj_class_p = SkBrain::get_class(ASymbol_Object);
     SK_ASSERTX(obj_class_p, "Couldn't find the World class!");
     uint32_t var_pos;
     if (obj_class_p->get_class_data().find(ASymbolX_c_world, AMatch_first_found, &var_pos))
       {
-      world_var_p = obj_class_p->get_class_data().get_at(var_pos);
+      ms_world_var_p = obj_class_p->get_class_data().get_at(var_pos);
       }
     else
       {
@@ -39,8 +54,14 @@ UWorld * SkUEClassBindingHelper::get_world()
       }
     }
 
-  SK_ASSERTX(world_var_p->m_data_p && (world_var_p->m_data_p == SkBrain::ms_nil_p || world_var_p->m_data_p->get_class() == SkBrain::get_class(ASymbol_World)), "@@world variable does not have proper type."); // nil is ok
-  return world_var_p->m_data_p == SkBrain::ms_nil_p ? nullptr : world_var_p->m_data_p->as<SkUEWorld>();
+  return ms_world_var_p;
+  }
+
+//---------------------------------------------------------------------------------------
+
+void SkUEClassBindingHelper::reset_class_data_vars()
+  {
+  ms_world_var_p = nullptr;
   }
 
 //---------------------------------------------------------------------------------------
@@ -100,6 +121,60 @@ UProperty * SkUEClassBindingHelper::find_class_property(UClass * class_p, FName
   return nullptr;
   }
 
+//---------------------------------------------------------------------------------------
+// Find an instance method by name, looking in superclasses as well.
+// Each class gets its own map of every name looked up so far, so repeated calls by name
+// (e.g. from Blueprints) are a single hash lookup instead of converting the name to a
+// symbol and searching the method list of each class up the hierarchy.
+// Returns nullptr if there is no such instance method.
+SkMethodBase * SkUEClassBindingHelper::find_instance_method_cached(SkClass * sk_class_p, const FString & method_name)
+  {
+  // Demand loaded classes can be unloaded at any time, freeing their methods - so don't cache them
+  if (sk_class_p->is_demand_loaded())
+    {
+    // Being used so keep it loaded for longer
+    SkUERuntime::get_singleton()->get_class_group_residency()->touch(sk_class_p);
+    return sk_class_p->get_instance_method_inherited(FStringToASymbol(method_name));
+    }
+
+  tMethodMap & method_map = ms_method_cache.FindOrAdd(sk_class_p);
+  SkMethodBase ** method_pp = method_map.Find(method_name);
+  if (method_pp)
+    {
+    return *method_pp;
+    }
+
+  // Not looked up yet - also remember if it does not exist
+  SkMethodBase * method_p = sk_class_p->get_instance_method_inherited(FStringToASymbol(method_name));
+  method_map.Add(method_name, method_p);
+  return method_p;
+  }
+
+//---------------------------------------------------------------------------------------
+
+void SkUEClassBindingHelper::reset_method_cache()
+  {
+  ms_method_cache.Empty();
+  ++ms_method_epoch;
+  }
+
+//---------------------------------------------------------------------------------------
+// Only forget methods resolved for the specified class and its subclasses so lookups on
+// unrelated classes stay cached across a live update of a single class.
+void SkUEClassBindingHelper::reset_method_cache(SkClass * sk_class_p)
+  {
+  for (auto iter = ms_method_cache.CreateIterator(); iter; ++iter)
+    {
+    if (iter.Key()->is_class(*sk_class_p))
+      {
+      iter.RemoveCurrent();
+      }
+    }
+
+  // Caches kept elsewhere don't know which class their methods came from
+  ++ms_method_epoch;
+  }
+
 //---------------------------------------------------------------------------------------
 
 void SkUEClassBindingHelper::reset_static_class_mappings(uint32_t reserve)
@@ -166,3 +241,44 @@ SkClass * SkUEClassBindingHelper::add_dynamic_class_mapping(UClass * ue_class_p)
 
   return sk_class_p;
   }
+
+//---------------------------------------------------------------------------------------
+// Find an instance method by name, looking in the entries of this cache first.
+// Returns nullptr if there is no such instance method.
+SkMethodBase * SkUEMethodCache::find_instance_method(SkClass * sk_class_p, const FString & method_name)
+  {
+  // Forget all entries if methods have changed since they were cached
+  uint32_t epoch = SkUEClassBindingHelper::get_method_epoch();
+  if (m_epoch != epoch)
+    {
+    for (uint32_t i = 0u; i < Size; ++i)
+      {
+      m_entries[i].m_method_p = nullptr;
+      }
+    m_epoch = epoch;
+    }
+
+  for (uint32_t i = 0u; i < Size; ++i)
+    {
+    Entry & entry = m_entries[i];
+    if (entry.m_method_p && (entry.m_class_p == sk_class_p) && entry.m_name.Equals(method_name, ESearchCase::CaseSensitive))
+      {
+      return entry.m_method_p;
+      }
+    }
+
+  SkMethodBase * method_p = SkUEClassBindingHelper::find_instance_method_cached(sk_class_p, method_name);
+
+  // Methods of demand loaded classes might go away without notice so don't hold on to them
+  if (method_p && !sk_class_p->is_demand_loaded())
+    {
+    Entry & entry = m_entries[m_next];
+    entry.m_name = method_name;
+    entry.m_class_p = sk_class_p;
+    entry.m_method_p = method_p;
+    m_next = (m_next + 1u) % Size;
+    }
+
+  return method_p;
+  }
+
\ No newline at end of file
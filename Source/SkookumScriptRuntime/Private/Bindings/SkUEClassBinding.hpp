@@ -15,6 +15,15 @@
 
 #include <SkookumScript/SkClassBindingBase.hpp>
 
+//---------------------------------------------------------------------------------------
+// Key functions for FString keyed maps that compare case-sensitively like SkookumScript names do
+template<typename _ValueType>
+struct SkUEStringKeyFuncs : TDefaultMapKeyFuncs<FString, _ValueType, false>
+  {
+  static bool   Matches(const FString & a, const FString & b) { return a.Equals(b, ESearchCase::CaseSensitive); }
+  static uint32 GetKeyHash(const FString & key)               { return FCrc::StrCrc32(*key); }
+  };
+
 //---------------------------------------------------------------------------------------
 // Helper class providing useful global variables and static methods
 class SkUEClassBindingHelper
@@ -22,6 +31,8 @@ class SkUEClassBindingHelper
   public:
     
     static UWorld *     get_world(); // Get tha world
+    static SkTypedData * get_world_var(); // Get the @@world class data member - looked up once and then remembered
+    static void         reset_class_data_vars(); // Call whenever class data members may have been re-created
 
     static void         reset_static_class_mappings(uint32_t reserve);
     static void         add_static_class_mapping(SkClass * sk_class_p, UClass * ue_class_p);
@@ -32,8 +43,15 @@ class SkUEClassBindingHelper
 
     static UProperty *  find_class_property(UClass * class_p, FName property_name);
 
+    static SkMethodBase * find_instance_method_cached(SkClass * sk_class_p, const FString & method_name); // Look up (inherited) instance method by name, cached per class
+    static void           reset_method_cache(); // Call whenever methods may have been replaced or freed
+    static void           reset_method_cache(SkClass * sk_class_p); // Call whenever methods of a single class (and thus its subclasses) may have been replaced
+    static uint32_t       get_method_epoch()                      { return ms_method_epoch; } // Changes whenever the method cache is reset - for validating caches kept elsewhere
+
   protected:
 
+    typedef TMap<FString, SkMethodBase*, FDefaultSetAllocator, SkUEStringKeyFuncs<SkMethodBase*>> tMethodMap;
+
     static UClass *     add_dynamic_class_mapping(SkClassDescBase * sk_class_desc_p);
     static SkClass *    add_dynamic_class_mapping(UClass * ue_class_p);
 
@@ -41,6 +59,41 @@ class SkUEClassBindingHelper
     static TMap<SkClassDescBase*, UClass*>                ms_static_class_map_s2u; // Maps SkClasses to their respective UClasses
     static TMap<UClass*, SkClass*>                        ms_dynamic_class_map_u2s; // Maps UClasses to their respective SkClasses
     static TMap<SkClassDescBase*, TWeakObjectPtr<UClass>> ms_dynamic_class_map_s2u; // Maps SkClasses to their respective UClasses
+    static TMap<SkClass*, tMethodMap>                     ms_method_cache; // Flattened per-class map of method names to resolved instance methods
+    static uint32_t                                       ms_method_epoch; // Incremented by reset_method_cache()
+    static SkTypedData *                                  ms_world_var_p; // Cached @@world class data member
+
+  };
+
+//---------------------------------------------------------------------------------------
+// Inline cache of the last few instance methods looked up by name from a single call site
+// (e.g. a SkookumScriptComponent) - most call sites keep calling the same one or two
+// methods so a hit is just a few string compares.  Misses go to
+// SkUEClassBindingHelper::find_instance_method_cached().
+class SkUEMethodCache
+  {
+  public:
+
+    enum { Size = 4 };
+
+    SkUEMethodCache() : m_epoch(0u), m_next(0u) {}
+
+    SkMethodBase * find_instance_method(SkClass * sk_class_p, const FString & method_name);
+
+  protected:
+
+    struct Entry
+      {
+      FString        m_name;
+      SkClass *      m_class_p; // Receiver class the method was resolved for
+      SkMethodBase * m_method_p;
+
+      Entry() : m_class_p(nullptr), m_method_p(nullptr) {}
+      };
+
+    Entry    m_entries[Size];
+    uint32_t m_epoch; // Method epoch of SkUEClassBindingHelper the entries are valid for
+    uint32_t m_next;  // Entry to replace next
 
   };
 
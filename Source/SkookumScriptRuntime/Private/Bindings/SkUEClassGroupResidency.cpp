@@ -0,0 +1,228 @@
+//=======================================================================================
+// SkookumScript Plugin for Unreal Engine 4
+// Copyright (c) 2015 Agog Labs Inc. All rights reserved.
+//
+// Residency manager for demand loaded SkookumScript class groups
+//=======================================================================================
+
+
+//=======================================================================================
+// Includes
+//=======================================================================================
+
+#include "../SkookumScriptRuntimePrivatePCH.h"
+#include "SkUEClassGroupResidency.hpp"
+#include "SkUERuntime.hpp"
+#include "SkUEBlueprintInterface.hpp"
+
+
+//=======================================================================================
+// SkUEClassGroupResidency Methods
+//=======================================================================================
+
+//---------------------------------------------------------------------------------------
+// Starts tracking a class group that was just loaded - called by
+// SkUERuntime::load_compiled_class_group().
+void SkUEClassGroupResidency::on_class_group_loaded(SkClass * class_p, uint32_t binary_size)
+  {
+  double now = FPlatformTime::Seconds();
+  int32  idx = find_group(class_p);
+
+  if (idx == INDEX_NONE)
+    {
+    ResidentGroup group = { class_p, binary_size, now };
+
+    m_groups.Add(group);
+    m_resident_bytes += binary_size;
+    }
+  else
+    {
+    ResidentGroup & group = m_groups[idx];
+
+    m_resident_bytes += binary_size - group.m_size;
+    group.m_size = binary_size;
+    group.m_last_use_time = now;
+    }
+
+  m_group_sizes.Add(class_p->get_name_id(), binary_size);
+
+  // Remember for the next time this world starts
+  if (!m_world_name.IsEmpty())
+    {
+    m_world_groups.FindOrAdd(m_world_name).AddUnique(class_p->get_name());
+    }
+  }
+
+//---------------------------------------------------------------------------------------
+// Called when a SkookumScriptComponent creates its instance - the class group of the
+// instance is kept loaded until all such instances are gone.
+void SkUEClassGroupResidency::on_instance_created(SkClass * class_p)
+  {
+  SkClass * root_p = class_p->get_demand_loaded_root();
+
+  if (root_p)
+    {
+    m_instance_counts.FindOrAdd(root_p)++;
+    touch(class_p);
+    }
+  }
+
+//---------------------------------------------------------------------------------------
+// Called when a SkookumScriptComponent releases its instance.
+void SkUEClassGroupResidency::on_instance_destroyed(SkClass * class_p)
+  {
+  SkClass * root_p  = class_p->get_demand_loaded_root();
+  int32 *   count_p = root_p ? m_instance_counts.Find(root_p) : nullptr;
+
+  if (count_p && (--(*count_p) <= 0))
+    {
+    m_instance_counts.Remove(root_p);
+    }
+  }
+
+//---------------------------------------------------------------------------------------
+// Marks class group containing the specified class as just used so it is among the last
+// to be unloaded.  Ignored if the class is not demand loaded.
+void SkUEClassGroupResidency::touch(SkClass * class_p)
+  {
+  SkClass * root_p = class_p->get_demand_loaded_root();
+  int32     idx    = root_p ? find_group(root_p) : INDEX_NONE;
+
+  if (idx != INDEX_NONE)
+    {
+    m_groups[idx].m_last_use_time = FPlatformTime::Seconds();
+    }
+  }
+
+//---------------------------------------------------------------------------------------
+// Stops tracking class groups that were unloaded and, if over budget, unloads the least
+// recently used class groups until back within budget.
+void SkUEClassGroupResidency::update()
+  {
+  // Forget groups that were unloaded by other means
+  for (int32 idx = m_groups.Num() - 1; idx >= 0; idx--)
+    {
+    if (!m_groups[idx].m_class_p->is_loaded())
+      {
+      m_resident_bytes -= m_groups[idx].m_size;
+      m_groups.RemoveAtSwap(idx);
+      }
+    }
+
+  if ((m_budget_bytes == 0u) || (m_resident_bytes <= m_budget_bytes))
+    {
+    return;
+    }
+
+  m_groups.Sort([](const ResidentGroup & lhs, const ResidentGroup & rhs) { return lhs.m_last_use_time < rhs.m_last_use_time; });
+
+  // Groups waiting on a deferred unload count as gone already
+  uint32_t resident_bytes = m_resident_bytes;
+
+  for (const ResidentGroup & group : m_groups)
+    {
+    if (group.m_class_p->is_unload_deferred())
+      {
+      resident_bytes -= group.m_size;
+      }
+    }
+
+  for (int32 idx = 0; (idx < m_groups.Num()) && (resident_bytes > m_budget_bytes); )
+    {
+    ResidentGroup & group = m_groups[idx];
+    SkClass *       class_p = group.m_class_p;
+
+    if (!is_evictable(class_p))
+      {
+      idx++;
+      continue;
+      }
+
+    class_p->demand_unload();
+    resident_bytes -= group.m_size;
+
+    if (class_p->is_loaded())
+      {
+      // Unload deferred until the group is no longer in use
+      idx++;
+      continue;
+      }
+
+    m_resident_bytes -= group.m_size;
+    m_groups.RemoveAt(idx);
+    }
+  }
+
+//---------------------------------------------------------------------------------------
+// Forgets all class groups - for when the class hierarchy is about to be replaced.
+// Class groups remembered for each world are kept since they are stored by name.
+void SkUEClassGroupResidency::reset()
+  {
+  m_groups.Empty();
+  m_instance_counts.Empty();
+  m_resident_bytes = 0u;
+  }
+
+//---------------------------------------------------------------------------------------
+// Called when a world is initialized - starts loading the class groups used the last
+// time the same world was running.  Groups that would not fit in the budget are skipped
+// so they are not just unloaded again on the next update().
+void SkUEClassGroupResidency::on_world_init(const FString & world_name, SkUERuntime * runtime_p)
+  {
+  m_world_name = world_name;
+
+  const TArray<ASymbol> * class_names_p = m_world_groups.Find(world_name);
+
+  if (!class_names_p)
+    {
+    return;
+    }
+
+  // Resident bytes once the groups prefetched so far are loaded
+  uint32_t predicted_bytes = m_resident_bytes;
+
+  for (const ASymbol & class_name : *class_names_p)
+    {
+    SkClass * class_p = SkBrain::get_class(class_name);
+
+    if (class_p && class_p->is_demand_loaded_root() && !class_p->is_loaded() && !runtime_p->is_class_group_load_pending(*class_p))
+      {
+      const uint32_t * size_p = m_group_sizes.Find(class_name.get_id());
+      uint32_t         size   = size_p ? *size_p : 0u;
+
+      if ((m_budget_bytes != 0u) && (predicted_bytes + size > m_budget_bytes))
+        {
+        continue;
+        }
+
+      predicted_bytes += size;
+      runtime_p->load_compiled_class_group_async(class_p);
+      }
+    }
+  }
+
+//---------------------------------------------------------------------------------------
+// Determines if the class group with the specified root class may be unloaded now.
+// Only actor classes are considered - see the class description.
+bool SkUEClassGroupResidency::is_evictable(SkClass * class_p) const
+  {
+  return class_p->is_builtin_actor_class()
+    && !class_p->is_load_locked()
+    && !class_p->is_unload_deferred()
+    && !m_instance_counts.Contains(class_p)
+    && !SkUEBlueprintInterface::get()->has_method_entries_of(class_p);
+  }
+
+//---------------------------------------------------------------------------------------
+int32 SkUEClassGroupResidency::find_group(const SkClass * class_p) const
+  {
+  for (int32 idx = 0; idx < m_groups.Num(); idx++)
+    {
+    if (m_groups[idx].m_class_p == class_p)
+      {
+      return idx;
+      }
+    }
+
+  return INDEX_NONE;
+  }
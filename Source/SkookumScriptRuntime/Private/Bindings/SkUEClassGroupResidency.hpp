@@ -0,0 +1,105 @@
+//=======================================================================================
+// SkookumScript Plugin for Unreal Engine 4
+// Copyright (c) 2015 Agog Labs Inc. All rights reserved.
+//
+// Residency manager for demand loaded SkookumScript class groups
+//=======================================================================================
+
+#pragma once
+
+//=======================================================================================
+// Includes
+//=======================================================================================
+
+#include "Platform.h"  // Set up base types, etc for the platform
+
+
+//=======================================================================================
+// Global Structures
+//=======================================================================================
+
+class SkClass;
+class SkUERuntime;
+
+//---------------------------------------------------------------------------------------
+// Keeps the script code of demand loaded class groups within a memory budget.
+//
+// Tracks every demand loaded class group that is currently loaded along with the size of
+// its compiled binary and when it was last used.  If the total goes over budget, the least
+// recently used groups are unloaded.
+//
+// The plugin cannot see every use of a class from within scripts (instances created by
+// scripts, running coroutines, calls from other classes) so only groups that are provably
+// idle are unloaded.  That limits eviction to groups rooted at an actor class - an
+// SkActorClass knows all of its instances and SkActorClass::demand_unload() defers the
+// unload while any exist.  Groups of other classes stay loaded once loaded.  Actor class
+// groups are also kept while they:
+//   - are load locked (see SkClass::lock_load())
+//   - have instances owned by a SkookumScriptComponent
+//   - have methods exported to Blueprints
+//
+// Also remembers which class groups were loaded while each world (level) was running and
+// starts loading them asynchronously as soon as that world is initialized again - as long
+// as they fit in the budget.
+class SkUEClassGroupResidency
+  {
+  public:
+
+  // Methods
+
+    SkUEClassGroupResidency() : m_budget_bytes(0u), m_resident_bytes(0u) {}
+
+    // Budget of 0 means unlimited
+    void     set_budget(uint32_t budget_bytes)    { m_budget_bytes = budget_bytes; }
+    uint32_t get_budget() const                   { return m_budget_bytes; }
+    uint32_t get_resident_bytes() const           { return m_resident_bytes; }
+
+    void on_class_group_loaded(SkClass * class_p, uint32_t binary_size);
+    void on_instance_created(SkClass * class_p);
+    void on_instance_destroyed(SkClass * class_p);
+    void touch(SkClass * class_p);
+    void update();
+    void reset();
+
+    // Prediction
+
+      void on_world_init(const FString & world_name, SkUERuntime * runtime_p);
+
+  protected:
+
+  // Internal Structures
+
+    struct ResidentGroup
+      {
+      SkClass * m_class_p;
+      uint32_t  m_size;
+      double    m_last_use_time;
+      };
+
+  // Internal Methods
+
+    int32 find_group(const SkClass * class_p) const;
+    bool  is_evictable(SkClass * class_p) const;
+
+  // Data Members
+
+    uint32_t m_budget_bytes;
+
+    // Sum of m_size of all entries in m_groups
+    uint32_t m_resident_bytes;
+
+    TArray<ResidentGroup> m_groups;
+
+    // Number of component owned instances per demand loaded root class
+    TMap<SkClass *, int32> m_instance_counts;
+
+    // Names of class groups loaded while each world was running
+    TMap<FString, TArray<ASymbol>> m_world_groups;
+
+    // Binary size of each class group the last time it was loaded - by root class name id
+    TMap<uint32_t, uint32_t> m_group_sizes;
+
+    // World currently running - loaded class groups are remembered for it
+    FString m_world_name;
+
+  };  // SkUEClassGroupResidency
@@ -15,6 +15,7 @@
 #include "SkookumScriptRuntimePrivatePCH.h"
 #include "SkUERemote.hpp"
 #include "Bindings/SkUEBlueprintInterface.hpp"
+#include "Bindings/SkUEClassBinding.hpp"
 #include <AssertionMacros.h>
 //#include <ws2tcpip.h>
 
@@ -30,6 +31,186 @@ namespace
 } // End unnamed namespace
 
 
+//=======================================================================================
+// SkUERemoteReader Methods
+//=======================================================================================
+
+#ifdef SKOOKUM_REMOTE_UNREAL
+
+//---------------------------------------------------------------------------------------
+SkUERemoteReader::SkUERemoteReader(FSocket * socket_p) :
+  m_socket_p(socket_p),
+  m_datum_event_p(FPlatformProcess::CreateSynchEvent()),
+  m_size_idx(0u),
+  m_datum_p(nullptr),
+  m_datum_idx(0)
+  {
+  }
+
+//---------------------------------------------------------------------------------------
+// Must only be called once the reader thread has finished
+SkUERemoteReader::~SkUERemoteReader()
+  {
+  TArray<uint8> * datum_p;
+
+  while (m_datums.Dequeue(datum_p))
+    {
+    delete datum_p;
+    }
+
+  while (m_free_datums.Dequeue(datum_p))
+    {
+    delete datum_p;
+    }
+
+  delete m_datum_p;
+  delete m_datum_event_p;
+  }
+
+//---------------------------------------------------------------------------------------
+// Gets the next completed datum if there is one.  Pass it to recycle_datum() when done.
+bool SkUERemoteReader::pop_datum(TArray<uint8> ** datum_pp)
+  {
+  return m_datums.Dequeue(*datum_pp);
+  }
+
+//---------------------------------------------------------------------------------------
+// Hands a datum from pop_datum() back so its buffer can be reused for a later datum.
+void SkUERemoteReader::recycle_datum(TArray<uint8> * datum_p)
+  {
+  if (m_free_count.GetValue() >= FreeDatums_max)
+    {
+    delete datum_p;
+    return;
+    }
+
+  m_free_count.Increment();
+  m_free_datums.Enqueue(datum_p);
+  }
+
+//---------------------------------------------------------------------------------------
+// Blocks the calling thread until a datum is available, the connection is closed or the
+// wait times out.  Returns true if woken before the time out.
+bool SkUERemoteReader::wait_for_datum(uint32 wait_ms)
+  {
+  return !m_datums.IsEmpty() || is_closed() || m_datum_event_p->Wait(wait_ms);
+  }
+
+//---------------------------------------------------------------------------------------
+// Reader thread main loop
+uint32 SkUERemoteReader::Run()
+  {
+  while (m_stop_counter.GetValue() == 0)
+    {
+    // Time out regularly to check for Stop()
+    if (m_socket_p->Wait(ESocketWaitConditions::WaitForRead, FTimespan::FromMilliseconds(100.0))
+      && !receive())
+      {
+      // Connection closed or lost - let the game thread know so it can disconnect
+      m_closed_counter.Increment();
+      m_datum_event_p->Trigger();
+      break;
+      }
+    }
+
+  return 0u;
+  }
+
+//---------------------------------------------------------------------------------------
+void SkUERemoteReader::Stop()
+  {
+  m_stop_counter.Increment();
+  }
+
+//---------------------------------------------------------------------------------------
+// Reads whatever data is available and queues any datums it completes.
+// Returns false if the connection has been closed or the data received is not valid.
+bool SkUERemoteReader::receive()
+  {
+  uint32 bytes_available = 0u;
+
+  if (!m_socket_p->HasPendingData(bytes_available))
+    {
+    // Socket was signalled as readable without data - it was closed
+    return false;
+    }
+
+  while (bytes_available)
+    {
+    int32 bytes_read = 0;
+
+    if (!m_datum_p)
+      {
+      //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+      // Get datum size & prep datum
+      if (!m_socket_p->Recv(m_size_bytes + m_size_idx, a_min(bytes_available, uint32(sizeof(uint32_t)) - m_size_idx), bytes_read)
+        || (bytes_read <= 0))
+        {
+        return false;
+        }
+
+      m_size_idx      += bytes_read;
+      bytes_available -= bytes_read;
+
+      if (m_size_idx < sizeof(uint32_t))
+        {
+        continue;
+        }
+
+      uint32_t datum_size;
+
+      FMemory::Memcpy(&datum_size, m_size_bytes, sizeof(uint32_t));
+      m_size_idx = 0u;
+
+      // Every datum has at least a command - a size outside of that or the limit means the
+      // stream is out of sync or corrupt and nothing after it can be trusted
+      if ((datum_size < (ADatum_header_size + sizeof(uint32_t))) || (datum_size > uint32_t(Datum_max)))
+        {
+        return false;
+        }
+
+      if (m_free_datums.Dequeue(m_datum_p))
+        {
+        m_free_count.Decrement();
+        m_datum_p->Reset();
+        }
+      else
+        {
+        m_datum_p = new TArray<uint8>();
+        }
+
+      m_datum_p->AddUninitialized(int32(datum_size - ADatum_header_size));
+      m_datum_idx = 0;
+      }
+    else
+      {
+      //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+      // Resume filling datum
+      if (!m_socket_p->Recv(m_datum_p->GetData() + m_datum_idx, a_min(bytes_available, uint32(m_datum_p->Num() - m_datum_idx)), bytes_read)
+        || (bytes_read <= 0))
+        {
+        return false;
+        }
+
+      m_datum_idx     += bytes_read;
+      bytes_available -= bytes_read;
+      }
+
+    if (m_datum_idx == m_datum_p->Num())
+      {
+      // Datum fully received and ready to use
+      m_datums.Enqueue(m_datum_p);
+      m_datum_p = nullptr;
+      m_datum_event_p->Trigger();
+      }
+    }
+
+  return true;
+  }
+
+#endif  // SKOOKUM_REMOTE_UNREAL
+
+
 //=======================================================================================
 // SkUERemote Methods
 //=======================================================================================
@@ -42,7 +223,11 @@ namespace
 // #Author(s): Conan Reis
 SkUERemote::SkUERemote() :
   m_socket_p(nullptr),
-  m_data_idx(ADef_uint32)
+  m_reader_p(nullptr),
+  m_reader_thread_p(nullptr),
+  m_data_out_idx(0),
+  m_data_out_overflow(false),
+  m_data_out_connected(false)
   {
   }
 
@@ -52,81 +237,176 @@ SkUERemote::SkUERemote() :
 // #Author(s): Conan Reis
 SkUERemote::~SkUERemote()
   {
+  stop_reader();
   }
 
 //---------------------------------------------------------------------------------------
-// Processes any remotely received data and call on_cmd_recv() whenever enough data is
-// accumulated.
+// Processes any datums completely received by the reader thread by calling on_cmd_recv()
+// for each of them.  Disconnects if the reader thread found the connection closed - though
+// only once every datum it received before that has been processed.
 // 
 // #Author(s): Conan Reis
 void SkUERemote::process_incoming()
   {
-  //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
-  // Connected and data available?
-  uint32 bytes_available;
+  TArray<uint8> * datum_p;
 
-  while (is_connected() && m_socket_p->HasPendingData(bytes_available))
+  // Checked before draining - the reader queues its last datums before it flags the
+  // connection as closed so they are all processed by the loop below
+  bool closed_b = m_reader_p && m_reader_p->is_closed();
+
+  // Command may disconnect and thus remove the reader
+  while (m_reader_p && m_reader_p->pop_datum(&datum_p))
     {
-    //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
-    // Get datum size & prep datum
-    int32    bytes_read;
-    uint32_t datum_size;
+    // Reader only queues datums with a command though never trust the wire
+    if (datum_p->Num() >= 4)
+      {
+      // Parse command from IDE in place - straight from the buffer the reader filled
+      uint32_t cmd;
+      uint8 *  buffer_p = datum_p->GetData();
 
-    if (m_data_idx == ADef_uint32)
+      A_BYTE_STREAM_IN32(&cmd, &buffer_p);
+      on_cmd_recv(eCommand(cmd), buffer_p, uint32_t(datum_p->Num()) - 4u);
+      }
+
+    if (m_reader_p)
       {
-      // Not working on a partially filled datum so get size of new datum
-      if (bytes_available < sizeof(uint32_t))
-        {
-        // wait until there is enough data for size
-        return;
-        }
+      m_reader_p->recycle_datum(datum_p);
+      }
+    else
+      {
+      delete datum_p;
+      }
+    }
+
+  // A command may have disconnected or even reconnected with a new reader
+  if (closed_b && m_reader_p && m_reader_p->is_closed())
+    {
+    SkDebug::print("SkookumScript: Connection to remote IDE lost!\n", SkLocale_local, SkDPrintType_warning);
+    set_mode(SkLocale_embedded);
 
-      // Read datum size from socket
-      m_socket_p->Recv(reinterpret_cast<uint8 *>(&datum_size), sizeof(uint32_t), bytes_read);
+    return;
+    }
 
-      bytes_available -= sizeof(uint32_t);
-      datum_size -= ADatum_header_size;
-      m_data_in.ensure_size(datum_size, false);
-      m_data_in.set_data_length(datum_size);
-      m_data_idx = 0u;
+  // Send any replies along with anything queued since the last update
+  process_outgoing();
+  }
+
+//---------------------------------------------------------------------------------------
+// Sends as much of the queued outgoing command data as the socket will currently accept
+// without blocking.  Whatever is left is sent on a later call.
+// 
+// Disconnects if the socket fails with anything other than "would block" or if the IDE
+// stopped reading long enough for the queue to overflow.
+// 
+// #Notes
+//   Must be called from the game thread.
+void SkUERemote::process_outgoing()
+  {
+  bool send_error = false;
+  bool overflow   = false;
+
+    {
+    FScopeLock data_out_lock(&m_data_out_lock);
+
+    overflow = m_data_out_overflow;
+
+    if (overflow || (m_data_out_idx >= m_data_out.Num()))
+      {
+      m_data_out_overflow = false;
+      }
+    else if (!is_connected())
+      {
+      // Partial datums are meaningless to a new connection
+      m_data_out.Reset();
+      m_data_out_idx = 0;
       }
     else
       {
-      datum_size = m_data_in.get_data_length();
+      send_error = !send_data_out();
       }
+    }
 
-    //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
-    // Begin or resume filling datum
-    uint32_t cmd;
-    uint32_t bytes_to_read;
-    uint8 *  buffer_p = m_data_in.get_data_writable();
+  // Disconnect outside of the lock - set_mode() prints and so may queue more commands
+  if (send_error || overflow)
+    {
+    SkDebug::print(
+      overflow
+        ? "SkookumScript: Remote IDE stopped receiving commands - disconnecting!\n"
+        : "SkookumScript: Error sending to remote IDE - disconnecting!\n",
+      SkLocale_local,
+      SkDPrintType_warning);
+    set_mode(SkLocale_embedded);
+    }
+  }
+
+//---------------------------------------------------------------------------------------
+// Sends as much of m_data_out as the socket will currently accept without blocking.
+// 
+// #Notes
+//   Must be called while holding m_data_out_lock and while connected.
+//   
+// #Returns
+//   false if the socket failed with anything other than "would block"
+bool SkUERemote::send_data_out()
+  {
+  int32 bytes_sent = 0;
+
+  while (m_data_out_idx < m_data_out.Num())
+    {
+    if (!m_socket_p->Send(m_data_out.GetData() + m_data_out_idx, m_data_out.Num() - m_data_out_idx, bytes_sent))
+      {
+      // Socket buffer full is expected - anything else means the connection is gone
+      return ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM)->GetLastErrorCode() == SE_EWOULDBLOCK;
+      }
 
-    while (bytes_available
-      || (is_connected() && m_socket_p->HasPendingData(bytes_available)))
+    if (bytes_sent <= 0)
       {
-      bytes_to_read = a_min(bytes_available, datum_size - m_data_idx);
+      break;
+      }
 
-      // Read datum data from socket
-      m_socket_p->Recv(buffer_p + m_data_idx, bytes_to_read, bytes_read);
+    m_data_out_idx += bytes_sent;
+    }
 
-      m_data_idx += bytes_read;
-      bytes_available = 0; // Reset to refresh on next loop
+  if (m_data_out_idx >= m_data_out.Num())
+    {
+    // All sent - keep the buffer memory for the next batch
+    m_data_out.Reset();
+    m_data_out_idx = 0;
+    }
 
-      if (m_data_idx == datum_size)
-        {
-        // Datum fully received and ready to use
-        m_data_idx = ADef_uint32;
+  return true;
+  }
 
-        // Parse command from IDE
-        A_BYTE_STREAM_IN32(&cmd, &buffer_p);
-        on_cmd_recv(eCommand(cmd), buffer_p, datum_size - 4u);
+//---------------------------------------------------------------------------------------
+// Stops queuing commands and gives those already queued (replies, last prints, etc.) up
+// to DataOutFlush_ms to be sent before the connection is closed - anything still left
+// after that is discarded.
+void SkUERemote::flush_data_out()
+  {
+  FScopeLock data_out_lock(&m_data_out_lock);
+
+  m_data_out_connected = false;
+
+  // An overflow means the IDE stopped reading so waiting on it would be pointless
+  if (!m_data_out_overflow && is_connected())
+    {
+    double end_time = FPlatformTime::Seconds() + DataOutFlush_ms * 0.001;
+
+    while ((m_data_out_idx < m_data_out.Num()) && send_data_out())
+      {
+      double wait_secs = end_time - FPlatformTime::Seconds();
 
-        // Exit filling datum while loop & look for new datum
+      if ((wait_secs <= 0.0)
+        || !m_socket_p->Wait(ESocketWaitConditions::WaitForWrite, FTimespan::FromSeconds(wait_secs)))
+        {
         break;
         }
-      // loop back and continue to try filling datum
       }
-    } // While connected and has data
+    }
+
+  m_data_out.Reset();
+  m_data_out_idx      = 0;
+  m_data_out_overflow = false;
   }
 
 //---------------------------------------------------------------------------------------
@@ -153,6 +433,30 @@ AString SkUERemote::get_socket_str()
   return str;
   }
 
+//---------------------------------------------------------------------------------------
+// Starts receiving from the connected socket on a separate thread.
+void SkUERemote::start_reader()
+  {
+  m_reader_p        = new SkUERemoteReader(m_socket_p);
+  m_reader_thread_p = FRunnableThread::Create(m_reader_p, TEXT("SkookumIDE.RemoteReader"), 0u, TPri_BelowNormal);
+  }
+
+//---------------------------------------------------------------------------------------
+// Stops the reader thread (if running) and discards any datums it had not handed over.
+void SkUERemote::stop_reader()
+  {
+  if (m_reader_thread_p)
+    {
+    // Calls Stop() and waits for Run() to return
+    m_reader_thread_p->Kill(true);
+    delete m_reader_thread_p;
+    m_reader_thread_p = nullptr;
+    }
+
+  delete m_reader_p;
+  m_reader_p = nullptr;
+  }
+
 //---------------------------------------------------------------------------------------
 // Gets local host IP address using ini file as a guide
 // 
@@ -187,6 +491,11 @@ void SkUERemote::set_mode(eSkLocale mode)
     {
     //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
     // Stop old mode
+    flush_data_out();
+
+    // Reader thread must be done with the socket before it goes away
+    stop_reader();
+
     if (m_socket_p)
       {
       SkDebug::print(a_str_format("SkookumScript: Disconnecting... %s\n", get_socket_str().as_cstr()), SkLocale_local);
@@ -243,6 +552,17 @@ void SkUERemote::set_mode(eSkLocale mode)
           return;
           }
 
+        // Connect blocks but from now on only move data the socket is ready for so that a
+        // slow IDE never stalls the game thread
+        m_socket_p->SetNonBlocking(true);
+        start_reader();
+
+          {
+          FScopeLock data_out_lock(&m_data_out_lock);
+
+          m_data_out_connected = true;
+          }
+
         SkDebug::print(a_str_format("SkookumScript: Connected %s\n", get_socket_str().as_cstr()), SkLocale_local);
 
         set_connect_state(ConnectState_authenticating);
@@ -255,6 +575,14 @@ void SkUERemote::set_mode(eSkLocale mode)
 //---------------------------------------------------------------------------------------
 // Sends a command in datum form to the remote IDE
 // 
+// Commands are queued and sent by process_outgoing() so that many small commands (prints,
+// breakpoint hits, etc.) issued in the same update go out together in one write and a
+// datum the socket can only partially accept is finished on a later update rather than
+// being cut short.
+// 
+// May be called from worker threads (A_DPRINT, etc.) - commands are only queued while
+// connected and those from worker threads are silently dropped otherwise.
+// 
 // #Params
 //   datum: command in datum form from a cmd_*() method
 //   
@@ -262,22 +590,28 @@ void SkUERemote::set_mode(eSkLocale mode)
 // #Author(s): Conan Reis
 void SkUERemote::on_cmd_send(const ADatum & datum)
   {
-  if (is_connected())
+  bool game_thread_b = IsInGameThread();
+
     {
-    int32 bytes_sent = 0;
-
-    // $Note - CReis Assumes that Send() is able to transfer entire datum in 1 pass.
-    m_socket_p->Send(datum.get_buffer(), datum.get_length(), bytes_sent);
-
-    //if (bytes_sent < int32(datum.get_length()))
-    //  {
-    //  SkDebug::print(
-    //    "SkookumScript: Only part of the data was sent to the remote IDE!!\n",
-    //    SkLocale_local,
-    //    SkDPrintType_warning);
-    //  }
+    FScopeLock data_out_lock(&m_data_out_lock);
+
+    if (m_data_out_connected && (!game_thread_b || is_connected()))
+      {
+      if (m_data_out_overflow || ((m_data_out.Num() - m_data_out_idx + int32(datum.get_length())) > DataOut_max))
+        {
+        // IDE is not keeping up - drop command and disconnect in process_outgoing()
+        m_data_out_overflow = true;
+        }
+      else
+        {
+        m_data_out.Append(datum.get_buffer(), datum.get_length());
+        }
+
+      return;
+      }
     }
-  else
+
+  if (game_thread_b)
     {
     SkDebug::print(
       "SkookumScript: Remote IDE is not connected - command ignored!\n"
@@ -290,6 +624,10 @@ void SkUERemote::on_cmd_send(const ADatum & datum)
 //---------------------------------------------------------------------------------------
 void SkUERemote::on_class_updated(SkClass * class_p)
   {
+  // Methods and data members of this class and thus of its subclasses might have changed
+  SkUEClassBindingHelper::reset_method_cache(class_p);
+  SkUEClassBindingHelper::reset_class_data_vars();
+
 #if 0 // Disabled as it currently does not quite work right yet
   UClass * uclass_p = SkUEBlueprintInterface::get()->reinitialize_class(class_p);
   if (uclass_p)
@@ -308,7 +646,18 @@ double SkUERemote::get_elapsed_seconds()
 //---------------------------------------------------------------------------------------
 void SkUERemote::wait_for_update()
   {
-  FPlatformProcess::Sleep(.1f);
+  // Get queued commands out before waiting on their replies
+  process_outgoing();
+
+  if (m_reader_p)
+    {
+    m_reader_p->wait_for_datum(100u);
+    }
+  else
+    {
+    FPlatformProcess::Sleep(.1f);
+    }
+
   process_incoming();
   }
 
@@ -28,18 +28,109 @@
 
 #ifdef SKOOKUM_REMOTE_UNREAL
 
+//---------------------------------------------------------------------------------------
+// Receives datums from the remote IDE on its own thread so that large transfers (class
+// updates, symbol tables, etc.) never cost frame time.  Completed datums are handed to the
+// game thread through a queue and processed by SkUERemote::process_incoming().
+class SkUERemoteReader : public FRunnable
+  {
+  public:
+
+  // Nested Structures
+
+    enum
+      {
+      // Most datum buffers kept for reuse - beyond that recycled buffers are freed
+      FreeDatums_max = 8,
+
+      // Largest datum size (including its header) accepted from the IDE - anything larger
+      // is taken as a corrupt stream and the connection is dropped
+      Datum_max = 256 * 1024 * 1024
+      };
+
+  // Common Methods
+
+    SkUERemoteReader(FSocket * socket_p);
+    virtual ~SkUERemoteReader();
+
+  // Methods
+
+    // Game thread side
+
+      bool pop_datum(TArray<uint8> ** datum_pp);
+      void recycle_datum(TArray<uint8> * datum_p);
+      bool wait_for_datum(uint32 wait_ms);
+      bool is_closed() const                  { return m_closed_counter.GetValue() != 0; }
+
+    // Overridden from FRunnable
+
+      virtual uint32 Run() override;
+      virtual void   Stop() override;
+
+  protected:
+
+  // Internal Methods
+
+    bool receive();
+
+  // Data Members
+
+    FSocket * m_socket_p;
+
+    // Set by Stop() to end Run()
+    FThreadSafeCounter m_stop_counter;
+
+    // Set by Run() when it ended since the connection was closed, lost or sent bad data
+    FThreadSafeCounter m_closed_counter;
+
+    // Triggered whenever a datum is queued
+    FEvent * m_datum_event_p;
+
+    // Completed datums (without their size header) waiting for the game thread
+    TQueue<TArray<uint8> *, EQueueMode::Spsc> m_datums;
+
+    // Datum buffers handed back by the game thread for reuse.  Each keeps the capacity of
+    // the largest datum it held so that after the first few commands no datum - not even a
+    // symbol table or class binary - needs a new allocation.
+    TQueue<TArray<uint8> *, EQueueMode::Spsc> m_free_datums;
+    FThreadSafeCounter                        m_free_count;
+
+    // Datum size as it arrives - it may come in pieces like everything else
+    uint8    m_size_bytes[sizeof(uint32_t)];
+    uint32_t m_size_idx;
+
+    // Datum being filled - nullptr while reading a size
+    TArray<uint8> * m_datum_p;
+    int32           m_datum_idx;
+
+  };  // SkUERemoteReader
+
+
 //---------------------------------------------------------------------------------------
 // Skookum remote IDE communication commands that are specific to the server IDE.
 class SkUERemote : public SkookumRemoteRuntimeBase
   {
   public:
 
+  // Nested Structures
+
+    enum
+      {
+      // Most outgoing command bytes queued before the IDE is assumed to have stalled and
+      // the connection is dropped
+      DataOut_max = 16 * 1024 * 1024,
+
+      // Longest time spent sending still queued commands when disconnecting
+      DataOutFlush_ms = 250
+      };
+
   // Common Methods
 
     SkUERemote();
     ~SkUERemote();
 
     void                      process_incoming();
+    void                      process_outgoing();
 
     TSharedPtr<FInternetAddr> get_ip_address_local();
 
@@ -75,8 +166,9 @@ class SkUERemote : public SkookumRemoteRuntimeBase
     virtual bool spawn_remote_ide() override;
 
     //---------------------------------------------------------------------------------------
-    // Blocking 1/10 second (100 millisecond) wait for current thread/message handle as
-    // appropriate for current platform and project.
+    // Blocking wait of up to 1/10 second (100 millisecond) for current thread/message handle
+    // as appropriate for current platform and project - returns early if data arrives from
+    // the remote IDE.
     //
     // Notes:
     //   Should also update SkookumRemoteRuntimeBase derived objects if they aren't updated on
@@ -90,6 +182,10 @@ class SkUERemote : public SkookumRemoteRuntimeBase
   protected:
 
     AString                   get_socket_str();
+    void                      start_reader();
+    void                      stop_reader();
+    bool                      send_data_out();
+    void                      flush_data_out();
 
   // Events
 
@@ -100,11 +196,28 @@ class SkUERemote : public SkookumRemoteRuntimeBase
 
     FSocket *   m_socket_p;
 
-    // Datum that is filled when data is received
-    ADatum      m_data_in;
+    // Receives incoming datums on its own thread while connected
+    SkUERemoteReader * m_reader_p;
+    FRunnableThread *  m_reader_thread_p;
+
+    // Outgoing commands not yet accepted by the socket - sent in batches by
+    // process_outgoing() with capacity kept between batches
+    TArray<uint8> m_data_out;
+
+    // Index of first byte in m_data_out not yet sent
+    int32       m_data_out_idx;
+
+    // Set if commands were dropped since m_data_out was full - disconnects on the next
+    // process_outgoing()
+    bool        m_data_out_overflow;
+
+    // Set while connected so commands are only queued then - used instead of is_connected()
+    // since the socket may not be touched from worker threads
+    bool        m_data_out_connected;
 
-    // Data byte index point - ADef_uint32 when not in progress
-    uint32_t    m_data_idx;
+    // Commands may be sent from worker threads (via prints, etc.) so m_data_out and its
+    // associated members are only touched while holding this
+    FCriticalSection m_data_out_lock;
   
   };  // SkUERemote
 
@@ -16,6 +16,7 @@
 #include "SkUERuntime.hpp"
 #include "SkUERemote.hpp"
 #include "SkUEBindings.hpp"
+#include "SkUEClassBinding.hpp"
 
 #include "GenericPlatformProcess.h"
 #include <chrono>
@@ -28,6 +29,32 @@
 namespace
 {
 
+  //---------------------------------------------------------------------------------------
+  // Header of a compressed compiled binary file.
+  // Followed by a table of m_chunk_count compressed chunk sizes (uint32) and then the
+  // zlib compressed chunks themselves.  Each chunk decompresses to m_chunk_size bytes
+  // except for the last one which holds whatever remains.
+  struct SkCompressedBinaryHeader
+    {
+    enum
+      {
+      Magic          = 0x315a4b53,  // "SKZ1"
+      Chunk_size     = 256 * 1024,
+
+      // Sanity limits checked before trusting a header read from disk
+      Chunk_size_max = 16 * 1024 * 1024,
+      Size_max       = 1024 * 1024 * 1024
+      };
+
+    uint32_t m_magic;
+    uint32_t m_size;
+    uint32_t m_chunk_size;
+    uint32_t m_chunk_count;
+
+    // Worst case size of a zlib compressed chunk (same as zlib compressBound())
+    static uint32_t get_chunk_bound(uint32_t chunk_size) { return chunk_size + (chunk_size >> 12) + (chunk_size >> 14) + 13u; }
+    };
+
   //---------------------------------------------------------------------------------------
   // Custom Unreal Binary Handle Structure
   struct SkBinaryHandleUE : public SkBinaryHandle
@@ -42,6 +69,14 @@ namespace
         }
 
       //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+      virtual ~SkBinaryHandleUE()
+        {
+        FMemory::Free(m_binary_p);
+        }
+
+      //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+      // Reads a compiled binary file - either raw or in compressed form (see
+      // SkCompressedBinaryHeader) which is decompressed chunk by chunk as it is read.
       static SkBinaryHandleUE * create(const TCHAR * path_p)
         {
         FArchive * reader_p = IFileManager::Get().CreateFileReader(path_p);
@@ -51,29 +86,328 @@ namespace
           return nullptr;
           }
     
-        int32   size     = reader_p->TotalSize();
-        uint8 * binary_p = (uint8*)FMemory::Malloc(size);
+        int32                    size = reader_p->TotalSize();
+        SkCompressedBinaryHeader header;
 
-        if (!binary_p)
+        header.m_magic = 0u;
+
+        if (size >= int32(sizeof(header)))
           {
-          reader_p->Close();
-          delete reader_p;
+          reader_p->Serialize(&header, sizeof(header));
 
-          return nullptr;
+          if (header.m_magic != SkCompressedBinaryHeader::Magic)
+            {
+            reader_p->Seek(0);
+            }
+          }
+
+        uint8 * binary_p = nullptr;
+
+        if (header.m_magic == SkCompressedBinaryHeader::Magic)
+          {
+          binary_p = read_compressed(reader_p, header, size);
+          size     = header.m_size;
+          }
+        else
+          {
+          binary_p = (uint8*)FMemory::Malloc(size);
+
+          if (binary_p)
+            {
+            reader_p->Serialize(binary_p, size);
+
+            if (reader_p->IsError())
+              {
+              FMemory::Free(binary_p);
+              binary_p = nullptr;
+              }
+            }
           }
 
-        reader_p->Serialize(binary_p, size);
         reader_p->Close();
         delete reader_p;
 
-        return new SkBinaryHandleUE(binary_p, size);
+        return binary_p ? new SkBinaryHandleUE(binary_p, size) : nullptr;
+        }
+
+      //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+      // Reads and decompresses the chunks following a compressed binary header.
+      // Only one compressed chunk is held in memory at a time.
+      // Returns nullptr if the file is truncated or corrupt.
+      static uint8 * read_compressed(FArchive * reader_p, const SkCompressedBinaryHeader & header, int32 file_size)
+        {
+        // Validate header before allocating anything based on it
+        int64 table_end = int64(sizeof(header)) + int64(header.m_chunk_count) * sizeof(uint32_t);
+
+        if ((header.m_size == 0u)
+          || (header.m_size > SkCompressedBinaryHeader::Size_max)
+          || (header.m_chunk_size == 0u)
+          || (header.m_chunk_size > SkCompressedBinaryHeader::Chunk_size_max)
+          || (header.m_chunk_count != (header.m_size + header.m_chunk_size - 1u) / header.m_chunk_size)
+          || (table_end > file_size))
+          {
+          A_DPRINT("  ...compressed binary has an invalid header!\n");
+
+          return nullptr;
+          }
+
+        TArray<uint32_t> chunk_sizes;
+
+        chunk_sizes.AddUninitialized(header.m_chunk_count);
+        reader_p->Serialize(chunk_sizes.GetData(), header.m_chunk_count * sizeof(uint32_t));
+
+        // Compressed chunks must exactly fill the rest of the file
+        int64 compressed_total = 0;
+
+        for (uint32_t chunk_size : chunk_sizes)
+          {
+          if ((chunk_size == 0u) || (chunk_size > SkCompressedBinaryHeader::get_chunk_bound(header.m_chunk_size)))
+            {
+            compressed_total = -1;
+            break;
+            }
+
+          compressed_total += chunk_size;
+          }
+
+        if (reader_p->IsError() || (compressed_total < 0) || (table_end + compressed_total != file_size))
+          {
+          A_DPRINT("  ...compressed binary is truncated or corrupt!\n");
+
+          return nullptr;
+          }
+
+        uint8 * binary_p = (uint8*)FMemory::Malloc(header.m_size);
+
+        if (!binary_p)
+          {
+          return nullptr;
+          }
+
+        TArray<uint8> chunk;
+        uint32_t      offset = 0u;
+
+        for (uint32_t chunk_size : chunk_sizes)
+          {
+          uint32_t uncompressed_size = FMath::Min(header.m_chunk_size, header.m_size - offset);
+
+          chunk.Reset();
+          chunk.AddUninitialized(chunk_size);
+          reader_p->Serialize(chunk.GetData(), chunk_size);
+
+          if (reader_p->IsError()
+            || !FCompression::UncompressMemory(COMPRESS_ZLIB, binary_p + offset, uncompressed_size, chunk.GetData(), chunk_size))
+            {
+            A_DPRINT("  ...unable to decompress compiled binary!\n");
+            FMemory::Free(binary_p);
+
+            return nullptr;
+            }
+
+          offset += uncompressed_size;
+          }
+
+        if (offset != header.m_size)
+          {
+          FMemory::Free(binary_p);
+
+          return nullptr;
+          }
+
+        return binary_p;
         }
+
+      //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+      // Writes a raw compiled binary file in compressed form to the destination path -
+      // which may be the same as the source path.  The file is written under a temporary
+      // name first and then renamed so that an interrupted write never leaves a corrupt
+      // binary behind.
+      // Returns false if the file could not be read or written - already compressed files
+      // are just copied.
+      static bool compress(const TCHAR * src_path_p, const TCHAR * dest_path_p)
+        {
+        TArray<uint8> binary;
+
+        if (!FFileHelper::LoadFileToArray(binary, src_path_p))
+          {
+          return false;
+          }
+
+        if ((binary.Num() >= int32(sizeof(uint32_t)))
+          && (*reinterpret_cast<const uint32_t *>(binary.GetData()) == SkCompressedBinaryHeader::Magic))
+          {
+          return (FCString::Stricmp(src_path_p, dest_path_p) == 0)
+            || (IFileManager::Get().Copy(dest_path_p, src_path_p) == COPY_OK);
+          }
+
+        SkCompressedBinaryHeader header;
+
+        header.m_magic       = SkCompressedBinaryHeader::Magic;
+        header.m_size        = binary.Num();
+        header.m_chunk_size  = SkCompressedBinaryHeader::Chunk_size;
+        header.m_chunk_count = (header.m_size + header.m_chunk_size - 1u) / header.m_chunk_size;
+
+        TArray<uint32_t> chunk_sizes;
+        TArray<uint8>    chunks;
+        int32            bound = SkCompressedBinaryHeader::get_chunk_bound(header.m_chunk_size);
+
+        chunk_sizes.Reserve(header.m_chunk_count);
+
+        for (uint32_t offset = 0u; offset < header.m_size; offset += header.m_chunk_size)
+          {
+          int32 chunk_idx  = chunks.Num();
+          int32 chunk_size = bound;
+
+          chunks.AddUninitialized(bound);
+
+          if (!FCompression::CompressMemory(COMPRESS_ZLIB, chunks.GetData() + chunk_idx, chunk_size, binary.GetData() + offset, FMath::Min(header.m_chunk_size, header.m_size - offset)))
+            {
+            return false;
+            }
+
+          chunks.RemoveAt(chunk_idx + chunk_size, bound - chunk_size, false);
+          chunk_sizes.Add(chunk_size);
+          }
+
+        TArray<uint8> file;
+
+        file.Reserve(sizeof(header) + chunk_sizes.Num() * sizeof(uint32_t) + chunks.Num());
+        file.Append(reinterpret_cast<const uint8 *>(&header), sizeof(header));
+        file.Append(reinterpret_cast<const uint8 *>(chunk_sizes.GetData()), chunk_sizes.Num() * sizeof(uint32_t));
+        file.Append(chunks);
+
+        FString temp_path = FString(dest_path_p) + TEXT(".tmp");
+
+        if (!FFileHelper::SaveArrayToFile(file, *temp_path))
+          {
+          IFileManager::Get().Delete(*temp_path);
+
+          return false;
+          }
+
+        return IFileManager::Get().Move(dest_path_p, *temp_path);
+        }
+    };
+
+  //---------------------------------------------------------------------------------------
+  // Reads a compiled binary file on a worker thread.
+  // Only the file read is done in the background - parsing into SkBrain changes the shared
+  // class hierarchy and symbol tables so it must still be done on the game thread.
+  class SkBinaryReadTask : public FNonAbandonableTask
+    {
+    public:
+
+    // Public Data
+
+      FString            m_path;
+      SkBinaryHandleUE * m_handle_p;
+
+    // Public Methods
+
+      SkBinaryReadTask(const FString & path) : m_path(path), m_handle_p(nullptr) {}
+
+      void DoWork()                         { m_handle_p = SkBinaryHandleUE::create(*m_path); }
+      static const TCHAR * Name()           { return TEXT("SkBinaryReadTask"); }
+      FORCEINLINE TStatId GetStatId() const { RETURN_QUICK_DECLARE_CYCLE_STAT(SkBinaryReadTask, STATGROUP_ThreadPoolAsyncTasks); }
     };
 
+  //---------------------------------------------------------------------------------------
+  // Console command to write compressed copies of the compiled binaries to a staging
+  // directory - run before packaging a build to ship the smaller compressed form.
+  void compress_compiled_binaries_cmd(const TArray<FString> & args)
+    {
+    if (args.Num() != 1)
+      {
+      UE_LOG(LogSkookum, Warning, TEXT("Usage: Sk.CompressBinaries <output directory>"));
+      return;
+      }
+
+    bool success_b = SkUERuntime::get_singleton()->compress_compiled_binaries(args[0]);
+
+    UE_LOG(LogSkookum, Display, TEXT("SkookumScript compiled binaries %s compressed to '%s'."), success_b ? TEXT("were") : TEXT("could NOT all be"), *args[0]);
+    }
+
+  FAutoConsoleCommand g_compress_compiled_binaries_cmd(
+    TEXT("Sk.CompressBinaries"),
+    TEXT("Writes compressed copies of the compiled SkookumScript binaries to the given directory (e.g. a staging directory) so a packaged build ships the smaller compressed form."),
+    FConsoleCommandWithArgsDelegate::CreateStatic(&compress_compiled_binaries_cmd));
+
+  //---------------------------------------------------------------------------------------
+  // # Skookum:   Object@_load_class_group(Symbol class_name)
+  // Loads the class group of a demand loaded class in the background and completes once it
+  // is loaded - so scripts can get a class ready before using it without a hitch.
+  bool coro_load_class_group(SkInvokedCoroutine * scope_p)
+    {
+    SkClass * class_p = SkBrain::get_class(scope_p->get_arg<SkSymbol>(SkArg_1));
+    SkClass * root_p  = class_p ? class_p->get_demand_loaded_root() : nullptr;
+
+    // Nothing to wait for if not demand loaded or already loaded
+    if (!root_p || root_p->is_loaded())
+      {
+      return true;
+      }
+
+    SkUERuntime * runtime_p = SkUERuntime::get_singleton();
+
+    if (runtime_p->is_class_group_load_pending(*root_p))
+      {
+      return false;
+      }
+
+    // Load started earlier finished without loading the class - don't retry forever
+    if (scope_p->m_update_count)
+      {
+      return true;
+      }
+
+    return runtime_p->load_compiled_class_group_async(root_p);
+    }
+
 
 } // End unnamed namespace
 
 
+//---------------------------------------------------------------------------------------
+// Compiled binary being read in the background - see prefetch_binaries()
+struct SkUEAsyncBinaryRead
+  {
+  FAsyncTask<SkBinaryReadTask> m_read_task;
+
+  SkUEAsyncBinaryRead(const FString & path) : m_read_task(path) { m_read_task.StartBackgroundTask(); }
+
+  ~SkUEAsyncBinaryRead()
+    {
+    m_read_task.EnsureCompletion(false);
+    delete m_read_task.GetTask().m_handle_p;
+    }
+
+  // Waits for the read to finish and takes ownership of the binary
+  SkBinaryHandleUE * take_binary()
+    {
+    m_read_task.EnsureCompletion();
+
+    SkBinaryHandleUE * handle_p = m_read_task.GetTask().m_handle_p;
+
+    m_read_task.GetTask().m_handle_p = nullptr;
+
+    return handle_p;
+    }
+  };
+
+//---------------------------------------------------------------------------------------
+// Class group binary being read in the background - see load_compiled_class_group_async()
+struct SkUEAsyncClassGroupLoad
+  {
+  SkClass *                    m_class_p;
+  tSkClassGroupLoadedFunc      m_loaded_f;
+  void *                       m_user_data_p;
+  FAsyncTask<SkBinaryReadTask> m_read_task;
+
+  SkUEAsyncClassGroupLoad(SkClass * class_p, tSkClassGroupLoadedFunc loaded_f, void * user_data_p, const FString & path)
+    : m_class_p(class_p), m_loaded_f(loaded_f), m_user_data_p(user_data_p), m_read_task(path) {}
+  };
+
+
 //=======================================================================================
 // SkUERuntime Methods
 //=======================================================================================
@@ -131,6 +465,14 @@ void SkUERuntime::on_init()
       }
   #endif  // SKOOKUM_REMOTE_UNREAL
 
+  // Optional memory budget for demand loaded class groups
+  int32 class_group_budget_kb = 0;
+
+  if (GConfig && GConfig->GetInt(TEXT("SkookumScript"), TEXT("ClassGroupBudgetKB"), class_group_budget_kb, GGameIni))
+    {
+    m_residency.set_budget(uint32_t(FMath::Max(class_group_budget_kb, 0)) * 1024u);
+    }
+
   // Load the Skookum class hierarchy scripts in compiled binary form
   bool success_b = load_compiled_scripts();
 
@@ -148,6 +490,8 @@ void SkUERuntime::on_bind_routines()
   A_DPRINT(A_SOURCE_STR "\nBind routines for SkUERuntime.\n");
 
   SkUEBindings::register_all();
+
+  SkBrain::ms_object_class_p->register_coroutine_func("_load_class_group", coro_load_class_group, SkBindFlag_instance_no_rebind);
   }
 
 //---------------------------------------------------------------------------------------
@@ -162,6 +506,8 @@ void SkUERuntime::on_deinit()
     SkookumRemoteBase::ms_default_p->set_mode(SkLocale_embedded);
   #endif
 
+  cancel_async_loads();
+  m_residency.reset();
   deinit();
   }
 
@@ -184,6 +530,8 @@ void SkUERuntime::deinit()
 
   //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
   // Unloads SkookumScript and cleans-up
+  SkUEClassBindingHelper::reset_method_cache();
+  SkUEClassBindingHelper::reset_class_data_vars();
   SkookumScript::deinitialize_session();
   SkookumScript::deinitialize();
   }
@@ -253,7 +601,28 @@ bool SkUERuntime::load_compiled_scripts(
   {
   A_DPRINT("\nSkookumScript loading previously parsed compiled binary...\n");
 
-  if (load_compiled_hierarchy() != SkLoadStatus_ok)
+  // Class group reads in flight and resident class groups refer to classes that are about
+  // to be replaced
+  cancel_async_loads();
+  m_residency.reset();
+
+  // Any previously resolved methods and data members are about to be replaced
+  SkUEClassBindingHelper::reset_method_cache();
+  SkUEClassBindingHelper::reset_class_data_vars();
+
+  // Read the hierarchy and symbol table files at the same time rather than one after the
+  // other when load_compiled_hierarchy() asks for them
+  prefetch_binaries();
+
+  eSkLoadStatus load_status = load_compiled_hierarchy();
+
+  // Discard anything not asked for - such as when the hierarchy turned out to be stale
+  delete m_hierarchy_read_p;
+  delete m_symbol_table_read_p;
+  m_hierarchy_read_p    = nullptr;
+  m_symbol_table_read_p = nullptr;
+
+  if (load_status != SkLoadStatus_ok)
     {
     return false;
     }
@@ -291,6 +660,242 @@ bool SkUERuntime::load_compiled_scripts(
   return true;
   }
 
+//---------------------------------------------------------------------------------------
+// Writes compressed copies of the class hierarchy, class group and symbol table binaries
+// in the compiled directory to the specified output directory.  The loader reads either
+// form so this can be done as a packaging step for shipped builds to get smaller script
+// packages and less disk I/O at load.  Available as the `Sk.CompressBinaries` console
+// command.
+// 
+// The compiled directory itself is left alone - the IDE compiles into it and would just
+// overwrite the compressed files again.
+// 
+// #Params
+//   output_path:  directory to write the compressed binaries to - e.g. a staging directory
+//
+// #Returns
+//   true if all compiled binaries were written compressed, false if any could not be
+bool SkUERuntime::compress_compiled_binaries(const FString & output_path)
+  {
+  const FString & compiled_path = get_compiled_path();
+  TArray<FString> files;
+  bool            success_b = true;
+
+  if (FPaths::IsSamePath(output_path, compiled_path))
+    {
+    A_DPRINT("  Compressed binaries must not be written to the compiled directory '%ls'!\n", *compiled_path);
+
+    return false;
+    }
+
+  IFileManager::Get().MakeDirectory(*output_path, true);
+  IFileManager::Get().FindFiles(files, *(compiled_path / TEXT("*.sk-*")), true, false);
+
+  for (const FString & file : files)
+    {
+    if (!SkBinaryHandleUE::compress(*(compiled_path / file), *(output_path / file)))
+      {
+      A_DPRINT("  Unable to compress compiled binary file '%ls'!\n", *file);
+      success_b = false;
+      }
+    }
+
+  return success_b;
+  }
+
+//---------------------------------------------------------------------------------------
+// Loads the class group of a demand loaded class and starts tracking it for residency.
+// Called by the core whenever a class is demand loaded.  If an asynchronous load of the
+// class group is already under way its read is finished and used rather than reading the
+// file again - so prefetched classes only cost the parse.
+// 
+// #See:        SkUEClassGroupResidency, load_compiled_class_group_async()
+// #Modifiers:  virtual - overridden from SkookumRuntimeBase
+void SkUERuntime::load_compiled_class_group(SkClass * class_p)
+  {
+  // Not already committing a background read
+  if (!m_async_commit_p)
+    {
+    for (int32 idx = 0; idx < m_async_loads.Num(); idx++)
+      {
+      SkUEAsyncClassGroupLoad * load_p = m_async_loads[idx];
+
+      if (load_p->m_class_p == class_p)
+        {
+        m_async_loads.RemoveAt(idx);
+        load_p->m_read_task.EnsureCompletion();
+
+        if (commit_async_load(load_p))
+          {
+          return;
+          }
+
+        // Read failed - try once more directly
+        break;
+        }
+      }
+    }
+
+  m_class_group_size = 0u;
+
+  SkookumRuntimeBase::load_compiled_class_group(class_p);
+
+  if (class_p->is_loaded())
+    {
+    m_residency.on_class_group_loaded(class_p, m_class_group_size);
+    }
+  }
+
+//---------------------------------------------------------------------------------------
+// Starts loading the class group of a demand loaded class without blocking the caller.
+// The class group binary is read on a worker thread and then committed to the class
+// hierarchy on the game thread the next time update_async_loads() is called.
+// 
+// #Params
+//   class_p:  demand loaded root class to load
+//   loaded_f:
+//     optional function called on the game thread once the class group is loaded or
+//     failed to load.  Called immediately if the class is already loaded.
+//   user_data_p:  passed on to loaded_f
+//
+// #Returns
+//   true if the class was already loaded, false if a load was started
+// 
+// #See:        update_async_loads(), SkookumRuntimeBase::load_compiled_class_group()
+bool SkUERuntime::load_compiled_class_group_async(
+  SkClass *               class_p,
+  tSkClassGroupLoadedFunc loaded_f,    // = nullptr
+  void *                  user_data_p  // = nullptr
+  )
+  {
+  SK_ASSERTX(class_p->is_demand_loaded_root(), a_str_format("Tried to load class group of '%s' which is not a demand loaded root class!", class_p->get_name().as_cstr_dbg()));
+
+  if (class_p->is_loaded())
+    {
+    if (loaded_f)
+      {
+      (loaded_f)(class_p, true, user_data_p);
+      }
+
+    return true;
+    }
+
+  SkUEAsyncClassGroupLoad * load_p = new SkUEAsyncClassGroupLoad(class_p, loaded_f, user_data_p, get_class_group_path(*class_p));
+
+  load_p->m_read_task.StartBackgroundTask();
+  m_async_loads.Add(load_p);
+
+  return false;
+  }
+
+//---------------------------------------------------------------------------------------
+// Determines if an asynchronous load of the class group of the specified class is still
+// in progress.
+// 
+// #See:        load_compiled_class_group_async()
+bool SkUERuntime::is_class_group_load_pending(const SkClass & cls) const
+  {
+  for (const SkUEAsyncClassGroupLoad * load_p : m_async_loads)
+    {
+    if (load_p->m_class_p == &cls)
+      {
+      return true;
+      }
+    }
+
+  return false;
+  }
+
+//---------------------------------------------------------------------------------------
+// Commits any class group binaries that have finished reading in the background and
+// calls their completion functions.  Must be called on the game thread outside of a
+// SkookumScript update.
+// 
+// #See:        load_compiled_class_group_async()
+void SkUERuntime::update_async_loads()
+  {
+  int32 idx = 0;
+
+  while (idx < m_async_loads.Num())
+    {
+    SkUEAsyncClassGroupLoad * load_p = m_async_loads[idx];
+
+    if (!load_p->m_read_task.IsDone())
+      {
+      idx++;
+      continue;
+      }
+
+    m_async_loads.RemoveAt(idx);
+    commit_async_load(load_p);
+    }
+  }
+
+//---------------------------------------------------------------------------------------
+// Commits a class group binary that has finished reading in the background, calls its
+// completion function and frees the load.
+// 
+// #Returns
+//   true if the class group is now loaded
+// 
+// #See:        update_async_loads(), load_compiled_class_group()
+bool SkUERuntime::commit_async_load(SkUEAsyncClassGroupLoad * load_p)
+  {
+  SkClass * class_p  = load_p->m_class_p;
+  bool      loaded_b = class_p->is_loaded();
+
+  // Skip parse if class was loaded some other way in the meantime
+  if (!loaded_b && load_p->m_read_task.GetTask().m_handle_p)
+    {
+    // get_binary_class_group() hands over the binary that was already read
+    m_async_commit_p = load_p;
+    load_compiled_class_group(class_p);
+    m_async_commit_p = nullptr;
+    loaded_b = class_p->is_loaded();
+    }
+
+  if (load_p->m_read_task.GetTask().m_handle_p)
+    {
+    release_binary(load_p->m_read_task.GetTask().m_handle_p);
+    }
+
+  if (load_p->m_loaded_f)
+    {
+    (load_p->m_loaded_f)(class_p, loaded_b, load_p->m_user_data_p);
+    }
+
+  delete load_p;
+
+  return loaded_b;
+  }
+
+//---------------------------------------------------------------------------------------
+// Waits for any class group reads still in flight, discards them and notifies their
+// completion functions that the load did not happen.
+// 
+// #See:        load_compiled_class_group_async()
+void SkUERuntime::cancel_async_loads()
+  {
+  for (SkUEAsyncClassGroupLoad * load_p : m_async_loads)
+    {
+    load_p->m_read_task.EnsureCompletion(false);
+
+    if (load_p->m_read_task.GetTask().m_handle_p)
+      {
+      release_binary(load_p->m_read_task.GetTask().m_handle_p);
+      }
+
+    if (load_p->m_loaded_f)
+      {
+      (load_p->m_loaded_f)(load_p->m_class_p, false, load_p->m_user_data_p);
+      }
+
+    delete load_p;
+    }
+
+  m_async_loads.Empty();
+  }
+
 //---------------------------------------------------------------------------------------
 // Determines if binary for class hierarchy and associated info exists.
 // 
@@ -320,7 +925,9 @@ SkBinaryHandle * SkUERuntime::get_binary_hierarchy()
 
   A_DPRINT("  Loading compiled binary file '%ls'...\n", *compiled_file);
 
-  return SkBinaryHandleUE::create(*compiled_file);
+  return m_hierarchy_read_p
+    ? take_prefetched(&m_hierarchy_read_p)
+    : SkBinaryHandleUE::create(*compiled_file);
   }
 
 //---------------------------------------------------------------------------------------
@@ -331,12 +938,37 @@ SkBinaryHandle * SkUERuntime::get_binary_hierarchy()
 // #Modifiers:  virtual - overridden from SkookumRuntimeBase
 // #Author(s):  Conan Reis
 SkBinaryHandle * SkUERuntime::get_binary_class_group(const SkClass & cls)
+  {
+  SkBinaryHandleUE * handle_p;
+
+  // Use binary already read in the background if committing an asynchronous load
+  if (m_async_commit_p && (m_async_commit_p->m_class_p == &cls))
+    {
+    handle_p = m_async_commit_p->m_read_task.GetTask().m_handle_p;
+    m_async_commit_p->m_read_task.GetTask().m_handle_p = nullptr;
+    }
+  else
+    {
+    handle_p = SkBinaryHandleUE::create(*get_class_group_path(cls));
+    }
+
+  m_class_group_size = handle_p ? handle_p->m_size : 0u;
+
+  return handle_p;
+  }
+
+//---------------------------------------------------------------------------------------
+// Gets file path of binary for group of classes with specified class as root.
+// 
+// #See Also:   get_binary_class_group(), load_compiled_class_group_async()
+FString SkUERuntime::get_class_group_path(const SkClass & cls) const
   {
   FString compiled_file = get_compiled_path();
   
   // $Revisit - CReis Should use fast custom uint32_t to hex string function.
   compiled_file += a_cstr_format("/Class[%x].sk-bin", cls.get_name_id());
-  return SkBinaryHandleUE::create(*compiled_file);
+
+  return compiled_file;
   }
 
 
@@ -354,7 +986,9 @@ SkBinaryHandle * SkUERuntime::get_binary_symbol_table()
 
   A_DPRINT("  Loading compiled binary symbol file '%ls'...\n", *sym_file);
 
-  SkBinaryHandleUE * handle_p = SkBinaryHandleUE::create(*sym_file);
+  SkBinaryHandle * handle_p = m_symbol_table_read_p
+    ? take_prefetched(&m_symbol_table_read_p)
+    : SkBinaryHandleUE::create(*sym_file);
 
   // Ensure symbol table binary exists
   if (!handle_p)
@@ -368,6 +1002,43 @@ SkBinaryHandle * SkUERuntime::get_binary_symbol_table()
 #endif
 
 
+//---------------------------------------------------------------------------------------
+// Starts reading the compiled class hierarchy binary and (when debugging) the symbol table
+// binary on worker threads so that both files are read in parallel.  The getters then
+// only wait for the read that is already under way.
+// 
+// #See Also:   load_compiled_scripts(), take_prefetched()
+void SkUERuntime::prefetch_binaries()
+  {
+  if (!is_binary_hierarchy_existing())
+    {
+    return;
+    }
+
+  delete m_hierarchy_read_p;
+  m_hierarchy_read_p = new SkUEAsyncBinaryRead(get_compiled_path() / TEXT("Classes.sk-bin"));
+
+  #if (SKOOKUM & SK_DEBUG) && defined(A_SYMBOL_STR_DB)
+    delete m_symbol_table_read_p;
+    m_symbol_table_read_p = new SkUEAsyncBinaryRead(get_compiled_path() / TEXT("Classes.sk-sym"));
+  #endif
+  }
+
+//---------------------------------------------------------------------------------------
+// Waits for a prefetched binary and takes it over, freeing the read.
+// 
+// #See Also:   prefetch_binaries()
+SkBinaryHandle * SkUERuntime::take_prefetched(SkUEAsyncBinaryRead ** read_pp)
+  {
+  SkBinaryHandle * handle_p = (*read_pp)->take_binary();
+
+  delete *read_pp;
+  *read_pp = nullptr;
+
+  return handle_p;
+  }
+
+
 //---------------------------------------------------------------------------------------
 // #Author(s):  Conan Reis
 void SkUERuntime::release_binary(SkBinaryHandle * handle_p)
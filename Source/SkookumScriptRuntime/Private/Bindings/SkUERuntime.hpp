@@ -15,6 +15,7 @@
 
 #include <SkookumScript/SkookumRuntimeBase.hpp>
 #include "../SkookumScriptListenerManager.hpp"
+#include "SkUEClassGroupResidency.hpp"
 
 #include "Platform.h"  // Set up base types, etc for the platform
 
@@ -23,6 +24,14 @@
 // Global Structures
 //=======================================================================================
 
+// Pre-declarations
+struct SkUEAsyncBinaryRead;
+struct SkUEAsyncClassGroupLoad;
+
+// Called on the game thread once an asynchronous class group load has completed.
+// loaded_b is false if the class group binary could not be read.
+typedef void (* tSkClassGroupLoadedFunc)(SkClass * class_p, bool loaded_b, void * user_data_p);
+
 //---------------------------------------------------------------------------------------
 // SkookumScript Runtime Hooks for Unreal
 // - Input/Output Init/Update/Deinit Manager
@@ -34,7 +43,7 @@ class SkUERuntime : public SkookumRuntimeBase
 
   // Methods
 
-    SkUERuntime() : m_compiled_file_b(false), m_listener_manager(256, 256) { ms_default_p = this; }
+    SkUERuntime() : m_compiled_file_b(false), m_async_commit_p(nullptr), m_hierarchy_read_p(nullptr), m_symbol_table_read_p(nullptr), m_class_group_size(0u), m_listener_manager(256, 256) { ms_default_p = this; }
     ~SkUERuntime() {}
 
     // Script Loading / Binding
@@ -43,6 +52,17 @@ class SkUERuntime : public SkookumRuntimeBase
 
       bool load_compiled_scripts(bool ensure_atomics = true, SkClass ** ignore_classes_pp = nullptr, uint32_t ignore_count = 0u);
 
+      virtual void load_compiled_class_group(SkClass * class_p) override;
+
+      bool compress_compiled_binaries(const FString & output_path);
+
+    // Asynchronous Demand Loading
+
+      bool load_compiled_class_group_async(SkClass * class_p, tSkClassGroupLoadedFunc loaded_f = nullptr, void * user_data_p = nullptr);
+      bool is_class_group_load_pending(const SkClass & cls) const;
+      void update_async_loads();
+      void cancel_async_loads();
+
     // Overridden from SkookumRuntimeBase
 
       // Binary Serialization / Loading Overrides
@@ -66,10 +86,18 @@ class SkUERuntime : public SkookumRuntimeBase
 
       // Accessors
 
-        SkookumScriptListenerManager * get_listener_manager() { return &m_listener_manager; }
+        SkookumScriptListenerManager * get_listener_manager()       { return &m_listener_manager; }
+        SkUEClassGroupResidency *      get_class_group_residency()  { return &m_residency; }
 
   protected:
 
+    // Internal Methods
+
+      FString          get_class_group_path(const SkClass & cls) const;
+      bool             commit_async_load(SkUEAsyncClassGroupLoad * load_p);
+      void             prefetch_binaries();
+      SkBinaryHandle * take_prefetched(SkUEAsyncBinaryRead ** read_pp);
+
     // Internal class methods
 
       static void deinit();
@@ -79,6 +107,21 @@ class SkUERuntime : public SkookumRuntimeBase
       mutable bool        m_compiled_file_b;
       mutable FString     m_compiled_path;
 
+      // Class group reads in flight on background threads - committed in update_async_loads()
+      TArray<SkUEAsyncClassGroupLoad *> m_async_loads;
+
+      // Already read binary handed to the next get_binary_class_group() for its class
+      SkUEAsyncClassGroupLoad * m_async_commit_p;
+
+      // Compiled binaries read in parallel at the start of load_compiled_scripts()
+      SkUEAsyncBinaryRead * m_hierarchy_read_p;
+      SkUEAsyncBinaryRead * m_symbol_table_read_p;
+
+      // Binary size of the class group most recently handed out by get_binary_class_group()
+      uint32_t m_class_group_size;
+
+      SkUEClassGroupResidency m_residency;
+
       SkookumScriptListenerManager m_listener_manager;
 
   };  // SkUERuntime
@@ -0,0 +1,25 @@
+//=======================================================================================
+// SkookumScript C++ library.
+// Copyright (c) 2015 Agog Labs Inc. All rights reserved.
+//
+// SkookumScript array of Real values packed into a contiguous buffer
+//=======================================================================================
+
+#pragma once
+
+//=======================================================================================
+// Includes
+//=======================================================================================
+
+#include "SkPackedArray.hpp"
+#include <SkookumScript/SkReal.hpp>
+
+//---------------------------------------------------------------------------------------
+// SkookumScript array of Real values packed into a contiguous buffer
+class SkFloatArray : public SkPackedArray<SkFloatArray, SkReal>
+  {
+  public:
+
+    static void register_bindings();
+
+  };
@@ -0,0 +1,29 @@
+//=======================================================================================
+// SkookumScript C++ library.
+// Copyright (c) 2015 Agog Labs Inc. All rights reserved.
+//
+// SkookumScript array of Integer values packed into a contiguous buffer
+//=======================================================================================
+
+//=======================================================================================
+// Includes
+//=======================================================================================
+
+#include "../../SkookumScriptRuntimePrivatePCH.h"
+#include "SkIntArray.hpp"
+
+//---------------------------------------------------------------------------------------
+void SkIntArray::register_bindings()
+  {
+  // Common packed array methods
+  SkPackedArray::register_bindings("IntArray");
+
+  // Reductions specific to this element type
+  static const SkClass::MethodInitializerFunc methods_i[] =
+    {
+      { "max",     mthd_max },
+      { "min",     mthd_min },
+    };
+
+  ms_class_p->register_method_func_bulk(methods_i, A_COUNT_OF(methods_i), SkBindFlag_instance_no_rebind);
+  }
@@ -0,0 +1,25 @@
+//=======================================================================================
+// SkookumScript C++ library.
+// Copyright (c) 2015 Agog Labs Inc. All rights reserved.
+//
+// SkookumScript array of Integer values packed into a contiguous buffer
+//=======================================================================================
+
+#pragma once
+
+//=======================================================================================
+// Includes
+//=======================================================================================
+
+#include "SkPackedArray.hpp"
+#include <SkookumScript/SkInteger.hpp>
+
+//---------------------------------------------------------------------------------------
+// SkookumScript array of Integer values packed into a contiguous buffer
+class SkIntArray : public SkPackedArray<SkIntArray, SkInteger>
+  {
+  public:
+
+    static void register_bindings();
+
+  };
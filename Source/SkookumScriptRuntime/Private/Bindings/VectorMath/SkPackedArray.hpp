@@ -0,0 +1,397 @@
+//=======================================================================================
+// SkookumScript C++ library.
+// Copyright (c) 2015 Agog Labs Inc. All rights reserved.
+//
+// Common base for arrays of values packed into a contiguous native buffer
+//=======================================================================================
+
+#pragma once
+
+//=======================================================================================
+// Includes
+//=======================================================================================
+
+#include <SkookumScript/SkClassBinding.hpp>
+
+//---------------------------------------------------------------------------------------
+// Class binding for an array of _ElemBindingClass values that are stored unboxed in a
+// single TArray rather than as a List of individually allocated instances.
+// Provides the methods shared by all packed arrays - element types add their own
+// (reductions etc.) in their register_bindings().
+template<class _BindingClass, class _ElemBindingClass>
+class SkPackedArray : public SkClassBindingSimple<_BindingClass, TArray<typename _ElemBindingClass::tDataType>>
+  {
+  public:
+
+    // Types
+
+    typedef typename _ElemBindingClass::tDataType tElemType;
+    typedef TArray<tElemType>                     tDataType;
+    typedef SkClassBindingBase<_BindingClass, tDataType> tBindingBase;
+
+    void destruct();
+
+    static void register_bindings(ASymbol class_name);
+
+  protected:
+
+    static bool is_valid_index(const tDataType & array, SkIntegerType idx, SkInvokedMethod * scope_p);
+    static void return_this(SkInvokedMethod * scope_p, SkInstance ** result_pp);
+
+    static void mthd_ctor_fill(SkInvokedMethod * scope_p, SkInstance ** result_pp);
+    static void mthd_ctor_list(SkInvokedMethod * scope_p, SkInstance ** result_pp);
+    static void mthd_at(SkInvokedMethod * scope_p, SkInstance ** result_pp);
+    static void mthd_at_set(SkInvokedMethod * scope_p, SkInstance ** result_pp);
+    static void mthd_append(SkInvokedMethod * scope_p, SkInstance ** result_pp);
+    static void mthd_as_list(SkInvokedMethod * scope_p, SkInstance ** result_pp);
+    static void mthd_empty(SkInvokedMethod * scope_p, SkInstance ** result_pp);
+    static void mthd_fill(SkInvokedMethod * scope_p, SkInstance ** result_pp);
+    static void mthd_length(SkInvokedMethod * scope_p, SkInstance ** result_pp);
+    static void mthd_length_set(SkInvokedMethod * scope_p, SkInstance ** result_pp);
+    static void mthd_slice(SkInvokedMethod * scope_p, SkInstance ** result_pp);
+    static void mthd_sum(SkInvokedMethod * scope_p, SkInstance ** result_pp);
+
+    // Only registered by element types that support them
+    static void mthd_average(SkInvokedMethod * scope_p, SkInstance ** result_pp);
+    static void mthd_max(SkInvokedMethod * scope_p, SkInstance ** result_pp);
+    static void mthd_min(SkInvokedMethod * scope_p, SkInstance ** result_pp);
+
+  };
+
+//=======================================================================================
+// Inline Functions
+//=======================================================================================
+
+//---------------------------------------------------------------------------------------
+// The base class only frees the TArray if it did not fit into m_user_data (such as on
+// 32-bit platforms) and was allocated from the heap - otherwise run its destructor in place
+// so its element buffer is freed.
+template<class _BindingClass, class _ElemBindingClass>
+void SkPackedArray<_BindingClass, _ElemBindingClass>::destruct()
+  {
+  if (sizeof(tDataType) > sizeof(this->m_user_data))
+    {
+    tBindingBase::destruct();
+    }
+  else
+    {
+    this->get_data().~tDataType();
+    }
+  }
+
+//---------------------------------------------------------------------------------------
+// Returns true if idx is within the array - reports a script error otherwise
+template<class _BindingClass, class _ElemBindingClass>
+bool SkPackedArray<_BindingClass, _ElemBindingClass>::is_valid_index(const tDataType & array, SkIntegerType idx, SkInvokedMethod * scope_p)
+  {
+  if (uint32_t(idx) < uint32_t(array.Num()))
+    {
+    return true;
+    }
+
+  SK_ERROR_INVOKED(a_str_format("Tried to access index %d of %s with length %d!", idx, tBindingBase::tBindingAbstract::ms_class_p->get_name().as_cstr_dbg(), array.Num()));
+  return false;
+  }
+
+//---------------------------------------------------------------------------------------
+// Returns this as result if desired
+template<class _BindingClass, class _ElemBindingClass>
+inline void SkPackedArray<_BindingClass, _ElemBindingClass>::return_this(SkInvokedMethod * scope_p, SkInstance ** result_pp)
+  {
+  if (result_pp)
+    {
+    SkInstance * this_p = scope_p->get_this();
+    this_p->reference();
+    *result_pp = this_p;
+    }
+  }
+
+//---------------------------------------------------------------------------------------
+// # Skookum:   ThisClass_@!fill(Integer length, <Elem> value)
+template<class _BindingClass, class _ElemBindingClass>
+void SkPackedArray<_BindingClass, _ElemBindingClass>::mthd_ctor_fill(SkInvokedMethod * scope_p, SkInstance ** result_pp)
+  {
+  tDataType & array = scope_p->get_this()->construct<_BindingClass>();
+  SkIntegerType length = scope_p->get_arg<SkInteger>(SkArg_1);
+
+  if (length > 0)
+    {
+    array.Init(scope_p->get_arg<_ElemBindingClass>(SkArg_2), length);
+    }
+  }
+
+//---------------------------------------------------------------------------------------
+// # Skookum:   ThisClass_@!list(List{<Elem>} list)
+template<class _BindingClass, class _ElemBindingClass>
+void SkPackedArray<_BindingClass, _ElemBindingClass>::mthd_ctor_list(SkInvokedMethod * scope_p, SkInstance ** result_pp)
+  {
+  tDataType & array = scope_p->get_this()->construct<_BindingClass>();
+  const SkInstanceList & list = scope_p->get_arg<SkList>(SkArg_1);
+  uint32_t length = list.get_length();
+  SkInstance ** items_pp = list.get_array();
+
+  array.Reserve(length);
+  for (uint32_t i = 0u; i < length; ++i)
+    {
+    array.Add(items_pp[i]->as<_ElemBindingClass>());
+    }
+  }
+
+//---------------------------------------------------------------------------------------
+// # Skookum:   ThisClass_@at(Integer idx) <Elem>
+template<class _BindingClass, class _ElemBindingClass>
+void SkPackedArray<_BindingClass, _ElemBindingClass>::mthd_at(SkInvokedMethod * scope_p, SkInstance ** result_pp)
+  {
+  // Do nothing if result not desired
+  if (result_pp)
+    {
+    const tDataType & array = scope_p->this_as<_BindingClass>();
+    SkIntegerType idx = scope_p->get_arg<SkInteger>(SkArg_1);
+
+    *result_pp = _ElemBindingClass::new_instance(is_valid_index(array, idx, scope_p) ? array[idx] : tElemType(0));
+    }
+  }
+
+//---------------------------------------------------------------------------------------
+// # Skookum:   ThisClass_@at_set(Integer idx, <Elem> value) ThisClass_
+template<class _BindingClass, class _ElemBindingClass>
+void SkPackedArray<_BindingClass, _ElemBindingClass>::mthd_at_set(SkInvokedMethod * scope_p, SkInstance ** result_pp)
+  {
+  tDataType & array = scope_p->this_as<_BindingClass>();
+  SkIntegerType idx = scope_p->get_arg<SkInteger>(SkArg_1);
+
+  if (is_valid_index(array, idx, scope_p))
+    {
+    array[idx] = scope_p->get_arg<_ElemBindingClass>(SkArg_2);
+    }
+
+  return_this(scope_p, result_pp);
+  }
+
+//---------------------------------------------------------------------------------------
+// # Skookum:   ThisClass_@append(<Elem> value) ThisClass_
+template<class _BindingClass, class _ElemBindingClass>
+void SkPackedArray<_BindingClass, _ElemBindingClass>::mthd_append(SkInvokedMethod * scope_p, SkInstance ** result_pp)
+  {
+  scope_p->this_as<_BindingClass>().Add(scope_p->get_arg<_ElemBindingClass>(SkArg_1));
+
+  return_this(scope_p, result_pp);
+  }
+
+//---------------------------------------------------------------------------------------
+// # Skookum:   ThisClass_@as_list() List{<Elem>}
+template<class _BindingClass, class _ElemBindingClass>
+void SkPackedArray<_BindingClass, _ElemBindingClass>::mthd_as_list(SkInvokedMethod * scope_p, SkInstance ** result_pp)
+  {
+  // Do nothing if result not desired
+  if (result_pp)
+    {
+    const tDataType & array = scope_p->this_as<_BindingClass>();
+    uint32_t length = array.Num();
+    SkInstance * list_p = SkList::new_instance(length);
+    APArray<SkInstance> & instances = list_p->as<SkList>().get_instances();
+
+    for (uint32_t i = 0u; i < length; ++i)
+      {
+      // Already referenced so directly append to underlying array
+      instances.append(*_ElemBindingClass::new_instance(array[i]));
+      }
+
+    *result_pp = list_p;
+    }
+  }
+
+//---------------------------------------------------------------------------------------
+// # Skookum:   ThisClass_@empty() ThisClass_
+template<class _BindingClass, class _ElemBindingClass>
+void SkPackedArray<_BindingClass, _ElemBindingClass>::mthd_empty(SkInvokedMethod * scope_p, SkInstance ** result_pp)
+  {
+  // Keep the memory around since the array is likely to be filled again
+  scope_p->this_as<_BindingClass>().Reset();
+
+  return_this(scope_p, result_pp);
+  }
+
+//---------------------------------------------------------------------------------------
+// # Skookum:   ThisClass_@fill(<Elem> value) ThisClass_
+template<class _BindingClass, class _ElemBindingClass>
+void SkPackedArray<_BindingClass, _ElemBindingClass>::mthd_fill(SkInvokedMethod * scope_p, SkInstance ** result_pp)
+  {
+  tDataType & array = scope_p->this_as<_BindingClass>();
+  const tElemType value = scope_p->get_arg<_ElemBindingClass>(SkArg_1);
+
+  for (tElemType * elem_p = array.GetData(), * end_p = elem_p + array.Num(); elem_p < end_p; ++elem_p)
+    {
+    *elem_p = value;
+    }
+
+  return_this(scope_p, result_pp);
+  }
+
+//---------------------------------------------------------------------------------------
+// # Skookum:   ThisClass_@length() Integer
+template<class _BindingClass, class _ElemBindingClass>
+void SkPackedArray<_BindingClass, _ElemBindingClass>::mthd_length(SkInvokedMethod * scope_p, SkInstance ** result_pp)
+  {
+  // Do nothing if result not desired
+  if (result_pp)
+    {
+    *result_pp = SkInteger::new_instance(scope_p->this_as<_BindingClass>().Num());
+    }
+  }
+
+//---------------------------------------------------------------------------------------
+// # Skookum:   ThisClass_@length_set(Integer length) ThisClass_
+template<class _BindingClass, class _ElemBindingClass>
+void SkPackedArray<_BindingClass, _ElemBindingClass>::mthd_length_set(SkInvokedMethod * scope_p, SkInstance ** result_pp)
+  {
+  tDataType & array = scope_p->this_as<_BindingClass>();
+  int32 length = FMath::Max(scope_p->get_arg<SkInteger>(SkArg_1), 0);
+  int32 old_length = array.Num();
+
+  if (length > old_length)
+    {
+    // New elements are zero
+    array.AddZeroed(length - old_length);
+    }
+  else if (length < old_length)
+    {
+    array.RemoveAt(length, old_length - length, false);
+    }
+
+  return_this(scope_p, result_pp);
+  }
+
+//---------------------------------------------------------------------------------------
+// # Skookum:   ThisClass_@slice(Integer idx, Integer count) ThisClass_
+template<class _BindingClass, class _ElemBindingClass>
+void SkPackedArray<_BindingClass, _ElemBindingClass>::mthd_slice(SkInvokedMethod * scope_p, SkInstance ** result_pp)
+  {
+  // Do nothing if result not desired
+  if (result_pp)
+    {
+    const tDataType & array = scope_p->this_as<_BindingClass>();
+    int32 length = array.Num();
+    int32 idx = FMath::Clamp(scope_p->get_arg<SkInteger>(SkArg_1), 0, length);
+    int32 count = FMath::Clamp(scope_p->get_arg<SkInteger>(SkArg_2), 0, length - idx);
+
+    SkInstance * slice_p = _BindingClass::new_instance();
+    slice_p->as<_BindingClass>().Append(array.GetData() + idx, count);
+    *result_pp = slice_p;
+    }
+  }
+
+//---------------------------------------------------------------------------------------
+// # Skookum:   ThisClass_@sum() <Elem>
+template<class _BindingClass, class _ElemBindingClass>
+void SkPackedArray<_BindingClass, _ElemBindingClass>::mthd_sum(SkInvokedMethod * scope_p, SkInstance ** result_pp)
+  {
+  // Do nothing if result not desired
+  if (result_pp)
+    {
+    const tDataType & array = scope_p->this_as<_BindingClass>();
+    tElemType sum(0);
+
+    for (const tElemType * elem_p = array.GetData(), * end_p = elem_p + array.Num(); elem_p < end_p; ++elem_p)
+      {
+      sum += *elem_p;
+      }
+
+    *result_pp = _ElemBindingClass::new_instance(sum);
+    }
+  }
+
+//---------------------------------------------------------------------------------------
+// # Skookum:   ThisClass_@average() <Elem>
+template<class _BindingClass, class _ElemBindingClass>
+void SkPackedArray<_BindingClass, _ElemBindingClass>::mthd_average(SkInvokedMethod * scope_p, SkInstance ** result_pp)
+  {
+  // Do nothing if result not desired
+  if (result_pp)
+    {
+    const tDataType & array = scope_p->this_as<_BindingClass>();
+    tElemType sum(0);
+
+    for (const tElemType * elem_p = array.GetData(), * end_p = elem_p + array.Num(); elem_p < end_p; ++elem_p)
+      {
+      sum += *elem_p;
+      }
+
+    *result_pp = _ElemBindingClass::new_instance(array.Num() ? sum / float(array.Num()) : sum);
+    }
+  }
+
+//---------------------------------------------------------------------------------------
+// # Skookum:   ThisClass_@max() <Elem>
+template<class _BindingClass, class _ElemBindingClass>
+void SkPackedArray<_BindingClass, _ElemBindingClass>::mthd_max(SkInvokedMethod * scope_p, SkInstance ** result_pp)
+  {
+  // Do nothing if result not desired
+  if (result_pp)
+    {
+    const tDataType & array = scope_p->this_as<_BindingClass>();
+    tElemType max_value(0);
+
+    if (array.Num())
+      {
+      max_value = array[0];
+      for (const tElemType * elem_p = array.GetData() + 1, * end_p = array.GetData() + array.Num(); elem_p < end_p; ++elem_p)
+        {
+        max_value = FMath::Max(max_value, *elem_p);
+        }
+      }
+
+    *result_pp = _ElemBindingClass::new_instance(max_value);
+    }
+  }
+
+//---------------------------------------------------------------------------------------
+// # Skookum:   ThisClass_@min() <Elem>
+template<class _BindingClass, class _ElemBindingClass>
+void SkPackedArray<_BindingClass, _ElemBindingClass>::mthd_min(SkInvokedMethod * scope_p, SkInstance ** result_pp)
+  {
+  // Do nothing if result not desired
+  if (result_pp)
+    {
+    const tDataType & array = scope_p->this_as<_BindingClass>();
+    tElemType min_value(0);
+
+    if (array.Num())
+      {
+      min_value = array[0];
+      for (const tElemType * elem_p = array.GetData() + 1, * end_p = array.GetData() + array.Num(); elem_p < end_p; ++elem_p)
+        {
+        min_value = FMath::Min(min_value, *elem_p);
+        }
+      }
+
+    *result_pp = _ElemBindingClass::new_instance(min_value);
+    }
+  }
+
+//---------------------------------------------------------------------------------------
+// Make method bindings known to SkookumScript
+template<class _BindingClass, class _ElemBindingClass>
+void SkPackedArray<_BindingClass, _ElemBindingClass>::register_bindings(ASymbol class_name)
+  {
+  tBindingBase::register_bindings(class_name);
+
+  static const SkClass::MethodInitializerFunc methods_i[] =
+    {
+      { "!fill",      mthd_ctor_fill },
+      { "!list",      mthd_ctor_list },
+
+      { "at",         mthd_at },
+      { "at_set",     mthd_at_set },
+      { "append",     mthd_append },
+      { "as_list",    mthd_as_list },
+      { "empty",      mthd_empty },
+      { "fill",       mthd_fill },
+      { "length",     mthd_length },
+      { "length_set", mthd_length_set },
+      { "slice",      mthd_slice },
+      { "sum",        mthd_sum },
+    };
+
+  tBindingBase::tBindingAbstract::ms_class_p->register_method_func_bulk(methods_i, A_COUNT_OF(methods_i), SkBindFlag_instance_no_rebind);
+  }
@@ -527,6 +527,410 @@ namespace SkVector3_Impl
     }
   */
 
+  //=======================================================================================
+  // Batch methods on List{Vector3}
+  //=======================================================================================
+
+  //---------------------------------------------------------------------------------------
+  // Holds the vectors of a List{Vector3} as separate x, y and z streams (structure of
+  // arrays) so the batch kernels below can process 4 vectors per step.  Streams are padded
+  // to a multiple of 4 and share a single allocation.
+  // Each batch method uses its own buffer on the stack so nothing is shared between calls.
+  struct SoABuffer
+    {
+    TArray<float> m_data;    // x, y, z and w streams back to back
+    float *       m_x_p;
+    float *       m_y_p;
+    float *       m_z_p;
+    float *       m_w_p;     // Scalar result per vector
+    uint32_t      m_count;   // Number of vectors currently stored
+    uint32_t      m_padded;  // m_count rounded up to a multiple of 4
+
+    SoABuffer() : m_x_p(nullptr), m_y_p(nullptr), m_z_p(nullptr), m_w_p(nullptr), m_count(0u), m_padded(0u) {}
+
+    void set_count(uint32_t count)
+      {
+      m_count  = count;
+      m_padded = (count + 3u) & ~3u;
+      m_data.SetNumUninitialized(m_padded * 4u);
+
+      // Streams stay 16 byte aligned since m_padded is a multiple of 4
+      m_x_p = m_data.GetData();
+      m_y_p = m_x_p + m_padded;
+      m_z_p = m_y_p + m_padded;
+      m_w_p = m_z_p + m_padded;
+
+      // Zero the padding so it does not produce denormals or NaNs
+      for (uint32_t i = count; i < m_padded; ++i)
+        {
+        m_x_p[i] = m_y_p[i] = m_z_p[i] = 0.0f;
+        }
+      }
+
+    // Copy the vectors of the supplied list into the streams
+    void gather(const SkInstanceList & list)
+      {
+      set_count(list.get_length());
+
+      float * x_p = m_x_p;
+      float * y_p = m_y_p;
+      float * z_p = m_z_p;
+      SkInstance ** inst_pp = list.get_array();
+      for (uint32_t i = 0u; i < m_count; ++i)
+        {
+        const FVector & vec = inst_pp[i]->as<SkVector3>();
+        x_p[i] = vec.X;
+        y_p[i] = vec.Y;
+        z_p[i] = vec.Z;
+        }
+      }
+
+    // Copy the streams back into the vectors of the supplied list
+    void scatter(const SkInstanceList & list) const
+      {
+      const float * x_p = m_x_p;
+      const float * y_p = m_y_p;
+      const float * z_p = m_z_p;
+      SkInstance ** inst_pp = list.get_array();
+      for (uint32_t i = 0u; i < m_count; ++i)
+        {
+        inst_pp[i]->as<SkVector3>().Set(x_p[i], y_p[i], z_p[i]);
+        }
+      }
+
+    // Make a new List{Real} from the scalar results
+    SkInstance * new_real_list() const
+      {
+      SkInstance * list_p = SkList::new_instance(m_count);
+      APArray<SkInstance> & instances = list_p->as<SkList>().get_instances();
+      const float * w_p = m_w_p;
+      for (uint32_t i = 0u; i < m_count; ++i)
+        {
+        // Already referenced so directly append to underlying array
+        instances.append(*SkReal::new_instance(w_p[i]));
+        }
+      return list_p;
+      }
+
+    // x,y,z += vec
+    void add(const FVector & vec)
+      {
+      const VectorRegister vx = VectorLoadFloat1(&vec.X);
+      const VectorRegister vy = VectorLoadFloat1(&vec.Y);
+      const VectorRegister vz = VectorLoadFloat1(&vec.Z);
+      float * x_p = m_x_p;
+      float * y_p = m_y_p;
+      float * z_p = m_z_p;
+      for (uint32_t i = 0u; i < m_padded; i += 4u)
+        {
+        VectorStore(VectorAdd(VectorLoad(x_p + i), vx), x_p + i);
+        VectorStore(VectorAdd(VectorLoad(y_p + i), vy), y_p + i);
+        VectorStore(VectorAdd(VectorLoad(z_p + i), vz), z_p + i);
+        }
+      }
+
+    // x,y,z *= num
+    void scale(float num)
+      {
+      const VectorRegister vnum = VectorLoadFloat1(&num);
+      float * x_p = m_x_p;
+      float * y_p = m_y_p;
+      float * z_p = m_z_p;
+      for (uint32_t i = 0u; i < m_padded; i += 4u)
+        {
+        VectorStore(VectorMultiply(VectorLoad(x_p + i), vnum), x_p + i);
+        VectorStore(VectorMultiply(VectorLoad(y_p + i), vnum), y_p + i);
+        VectorStore(VectorMultiply(VectorLoad(z_p + i), vnum), z_p + i);
+        }
+      }
+
+    // Scale x,y,z to unit length - vectors that are (nearly) zero are left as they are,
+    // same as FVector::Normalize()
+    void normalize()
+      {
+      const float small_number = SMALL_NUMBER;
+      const VectorRegister vsmall = VectorLoadFloat1(&small_number);
+      float * x_p = m_x_p;
+      float * y_p = m_y_p;
+      float * z_p = m_z_p;
+      for (uint32_t i = 0u; i < m_padded; i += 4u)
+        {
+        VectorRegister x = VectorLoad(x_p + i);
+        VectorRegister y = VectorLoad(y_p + i);
+        VectorRegister z = VectorLoad(z_p + i);
+        VectorRegister len_sq = VectorMultiplyAdd(x, x, VectorMultiplyAdd(y, y, VectorMultiply(z, z)));
+        VectorRegister mask = VectorCompareGT(len_sq, vsmall);
+        VectorRegister inv_len = VectorReciprocalSqrtAccurate(len_sq);
+        VectorStore(VectorSelect(mask, VectorMultiply(x, inv_len), x), x_p + i);
+        VectorStore(VectorSelect(mask, VectorMultiply(y, inv_len), y), y_p + i);
+        VectorStore(VectorSelect(mask, VectorMultiply(z, inv_len), z), z_p + i);
+        }
+      }
+
+    // x,y,z = xform.TransformPosition(x,y,z)
+    void transform(const FTransform & xform)
+      {
+      const FMatrix mtx = xform.ToMatrixWithScale();
+      const VectorRegister m00 = VectorLoadFloat1(&mtx.M[0][0]), m01 = VectorLoadFloat1(&mtx.M[0][1]), m02 = VectorLoadFloat1(&mtx.M[0][2]);
+      const VectorRegister m10 = VectorLoadFloat1(&mtx.M[1][0]), m11 = VectorLoadFloat1(&mtx.M[1][1]), m12 = VectorLoadFloat1(&mtx.M[1][2]);
+      const VectorRegister m20 = VectorLoadFloat1(&mtx.M[2][0]), m21 = VectorLoadFloat1(&mtx.M[2][1]), m22 = VectorLoadFloat1(&mtx.M[2][2]);
+      const VectorRegister m30 = VectorLoadFloat1(&mtx.M[3][0]), m31 = VectorLoadFloat1(&mtx.M[3][1]), m32 = VectorLoadFloat1(&mtx.M[3][2]);
+      float * x_p = m_x_p;
+      float * y_p = m_y_p;
+      float * z_p = m_z_p;
+      for (uint32_t i = 0u; i < m_padded; i += 4u)
+        {
+        VectorRegister x = VectorLoad(x_p + i);
+        VectorRegister y = VectorLoad(y_p + i);
+        VectorRegister z = VectorLoad(z_p + i);
+        VectorStore(VectorMultiplyAdd(x, m00, VectorMultiplyAdd(y, m10, VectorMultiplyAdd(z, m20, m30))), x_p + i);
+        VectorStore(VectorMultiplyAdd(x, m01, VectorMultiplyAdd(y, m11, VectorMultiplyAdd(z, m21, m31))), y_p + i);
+        VectorStore(VectorMultiplyAdd(x, m02, VectorMultiplyAdd(y, m12, VectorMultiplyAdd(z, m22, m32))), z_p + i);
+        }
+      }
+
+    // w = dot(x,y,z, vec)
+    void dot(const FVector & vec)
+      {
+      const VectorRegister vx = VectorLoadFloat1(&vec.X);
+      const VectorRegister vy = VectorLoadFloat1(&vec.Y);
+      const VectorRegister vz = VectorLoadFloat1(&vec.Z);
+      const float * x_p = m_x_p;
+      const float * y_p = m_y_p;
+      const float * z_p = m_z_p;
+      float * w_p = m_w_p;
+      for (uint32_t i = 0u; i < m_padded; i += 4u)
+        {
+        VectorStore(VectorMultiplyAdd(VectorLoad(x_p + i), vx, VectorMultiplyAdd(VectorLoad(y_p + i), vy, VectorMultiply(VectorLoad(z_p + i), vz))), w_p + i);
+        }
+      }
+
+    // w = distance_squared(x,y,z, vec)
+    void distance_squared(const FVector & vec)
+      {
+      const VectorRegister vx = VectorLoadFloat1(&vec.X);
+      const VectorRegister vy = VectorLoadFloat1(&vec.Y);
+      const VectorRegister vz = VectorLoadFloat1(&vec.Z);
+      const float * x_p = m_x_p;
+      const float * y_p = m_y_p;
+      const float * z_p = m_z_p;
+      float * w_p = m_w_p;
+      for (uint32_t i = 0u; i < m_padded; i += 4u)
+        {
+        VectorRegister dx = VectorSubtract(VectorLoad(x_p + i), vx);
+        VectorRegister dy = VectorSubtract(VectorLoad(y_p + i), vy);
+        VectorRegister dz = VectorSubtract(VectorLoad(z_p + i), vz);
+        VectorStore(VectorMultiplyAdd(dx, dx, VectorMultiplyAdd(dy, dy, VectorMultiply(dz, dz))), w_p + i);
+        }
+      }
+
+    // w = sqrt(w)
+    void sqrt()
+      {
+      float * w_p = m_w_p;
+      for (uint32_t i = 0u; i < m_count; ++i)
+        {
+        w_p[i] = FMath::Sqrt(w_p[i]);
+        }
+      }
+
+    };
+
+  //---------------------------------------------------------------------------------------
+  // Returns the list argument at the given index and references it as the result if desired
+  static const SkInstanceList & get_list_arg_as_result(SkInvokedMethod * scope_p, uint32_t arg_idx, SkInstance ** result_pp)
+    {
+    SkInstance * list_p = scope_p->get_arg(arg_idx);
+
+    if (result_pp)
+      {
+      list_p->reference();
+      *result_pp = list_p;
+      }
+
+    return list_p->as<SkList>();
+    }
+
+  //---------------------------------------------------------------------------------------
+  // Determines if the same Vector3 instance is in the list more than once or is also the
+  // supplied argument.  A batch would then apply its change once per instance rather than
+  // once per item, so the in-place batch methods process such lists item by item instead.
+  static bool is_list_aliased(const SkInstanceList & list, const SkInstance * arg_p = nullptr)
+    {
+    TSet<const SkInstance *> instances;
+    if (arg_p)
+      {
+      instances.Add(arg_p);
+      }
+
+    SkInstance ** inst_pp = list.get_array();
+    uint32_t      length  = list.get_length();
+    for (uint32_t i = 0u; i < length; ++i)
+      {
+      // An instance only referenced by the list cannot be in it twice or be the argument
+      if (inst_pp[i]->get_references() > 1u)
+        {
+        bool is_in_set = false;
+        instances.Add(inst_pp[i], &is_in_set);
+        if (is_in_set)
+          {
+          return true;
+          }
+        }
+      }
+
+    return false;
+    }
+
+  //---------------------------------------------------------------------------------------
+  // # Skookum:   Vector3@list_add_assign(List{Vector3} vecs, Vector3 vec) List{Vector3}
+  static void mthdc_list_add_assign(SkInvokedMethod * scope_p, SkInstance ** result_pp)
+    {
+    const SkInstanceList & list  = get_list_arg_as_result(scope_p, SkArg_1, result_pp);
+    SkInstance *           vec_p = scope_p->get_arg(SkArg_2);
+    const FVector &        vec   = vec_p->as<SkVector3>();
+
+    if (is_list_aliased(list, vec_p))
+      {
+      SkInstance ** inst_pp = list.get_array();
+      for (uint32_t i = 0u; i < list.get_length(); ++i)
+        {
+        inst_pp[i]->as<SkVector3>() += vec;
+        }
+      return;
+      }
+
+    SoABuffer soa;
+    soa.gather(list);
+    soa.add(vec);
+    soa.scatter(list);
+    }
+
+  //---------------------------------------------------------------------------------------
+  // # Skookum:   Vector3@list_multiply_assign(List{Vector3} vecs, Real num) List{Vector3}
+  static void mthdc_list_multiply_assign(SkInvokedMethod * scope_p, SkInstance ** result_pp)
+    {
+    const SkInstanceList & list = get_list_arg_as_result(scope_p, SkArg_1, result_pp);
+    float                  num  = scope_p->get_arg<SkReal>(SkArg_2);
+
+    if (is_list_aliased(list))
+      {
+      SkInstance ** inst_pp = list.get_array();
+      for (uint32_t i = 0u; i < list.get_length(); ++i)
+        {
+        inst_pp[i]->as<SkVector3>() *= num;
+        }
+      return;
+      }
+
+    SoABuffer soa;
+    soa.gather(list);
+    soa.scale(num);
+    soa.scatter(list);
+    }
+
+  //---------------------------------------------------------------------------------------
+  // # Skookum:   Vector3@list_normalize(List{Vector3} vecs) List{Vector3}
+  static void mthdc_list_normalize(SkInvokedMethod * scope_p, SkInstance ** result_pp)
+    {
+    const SkInstanceList & list = get_list_arg_as_result(scope_p, SkArg_1, result_pp);
+
+    if (is_list_aliased(list))
+      {
+      SkInstance ** inst_pp = list.get_array();
+      for (uint32_t i = 0u; i < list.get_length(); ++i)
+        {
+        inst_pp[i]->as<SkVector3>().Normalize();
+        }
+      return;
+      }
+
+    SoABuffer soa;
+    soa.gather(list);
+    soa.normalize();
+    soa.scatter(list);
+    }
+
+  //---------------------------------------------------------------------------------------
+  // # Skookum:   Vector3@list_transform_by(List{Vector3} vecs, Transform xform) List{Vector3}
+  static void mthdc_list_transform_by(SkInvokedMethod * scope_p, SkInstance ** result_pp)
+    {
+    const SkInstanceList & list  = get_list_arg_as_result(scope_p, SkArg_1, result_pp);
+    const FTransform &     xform = scope_p->get_arg<SkTransform>(SkArg_2);
+
+    if (is_list_aliased(list))
+      {
+      SkInstance ** inst_pp = list.get_array();
+      for (uint32_t i = 0u; i < list.get_length(); ++i)
+        {
+        FVector & vec = inst_pp[i]->as<SkVector3>();
+        vec = xform.TransformPosition(vec);
+        }
+      return;
+      }
+
+    SoABuffer soa;
+    soa.gather(list);
+    soa.transform(xform);
+    soa.scatter(list);
+    }
+
+  //---------------------------------------------------------------------------------------
+  // # Skookum:   Vector3@list_dot(List{Vector3} vecs, Vector3 vec) List{Real}
+  static void mthdc_list_dot(SkInvokedMethod * scope_p, SkInstance ** result_pp)
+    {
+    // Do nothing if result not desired
+    if (result_pp)
+      {
+      SoABuffer soa;
+      soa.gather(scope_p->get_arg<SkList>(SkArg_1));
+      soa.dot(scope_p->get_arg<SkVector3>(SkArg_2));
+      *result_pp = soa.new_real_list();
+      }
+    }
+
+  //---------------------------------------------------------------------------------------
+  // # Skookum:   Vector3@list_distance(List{Vector3} vecs, Vector3 vec) List{Real}
+  static void mthdc_list_distance(SkInvokedMethod * scope_p, SkInstance ** result_pp)
+    {
+    // Do nothing if result not desired
+    if (result_pp)
+      {
+      SoABuffer soa;
+      soa.gather(scope_p->get_arg<SkList>(SkArg_1));
+      soa.distance_squared(scope_p->get_arg<SkVector3>(SkArg_2));
+      soa.sqrt();
+      *result_pp = soa.new_real_list();
+      }
+    }
+
+  //---------------------------------------------------------------------------------------
+  // # Skookum:   Vector3@list_nearest_idx(List{Vector3} vecs, Vector3 vec) Integer
+  static void mthdc_list_nearest_idx(SkInvokedMethod * scope_p, SkInstance ** result_pp)
+    {
+    // Do nothing if result not desired
+    if (result_pp)
+      {
+      SoABuffer soa;
+      soa.gather(scope_p->get_arg<SkList>(SkArg_1));
+      soa.distance_squared(scope_p->get_arg<SkVector3>(SkArg_2));
+
+      int32_t nearest_idx = -1;
+      float   nearest_dist_sq = FLT_MAX;
+      const float * w_p = soa.m_w_p;
+      for (uint32_t i = 0u; i < soa.m_count; ++i)
+        {
+        if (w_p[i] < nearest_dist_sq)
+          {
+          nearest_dist_sq = w_p[i];
+          nearest_idx = int32_t(i);
+          }
+        }
+
+      *result_pp = SkInteger::new_instance(nearest_idx);
+      }
+    }
+
   //---------------------------------------------------------------------------------------
 
   // Instance method array
@@ -574,6 +978,18 @@ namespace SkVector3_Impl
       //{ "normalize",        mthd_normalize },
     };
 
+  // Class method array
+  static const SkClass::MethodInitializerFunc methods_c[] =
+    {
+      { "list_add_assign",      mthdc_list_add_assign },
+      { "list_multiply_assign", mthdc_list_multiply_assign },
+      { "list_normalize",       mthdc_list_normalize },
+      { "list_transform_by",    mthdc_list_transform_by },
+      { "list_dot",             mthdc_list_dot },
+      { "list_distance",        mthdc_list_distance },
+      { "list_nearest_idx",     mthdc_list_nearest_idx },
+    };
+
   } // namespace
 
 //---------------------------------------------------------------------------------------
@@ -582,4 +998,5 @@ void SkVector3::register_bindings()
   tBindingBase::register_bindings("Vector3");
 
   ms_class_p->register_method_func_bulk(SkVector3_Impl::methods_i, A_COUNT_OF(SkVector3_Impl::methods_i), SkBindFlag_instance_no_rebind);
+  ms_class_p->register_method_func_bulk(SkVector3_Impl::methods_c, A_COUNT_OF(SkVector3_Impl::methods_c), SkBindFlag_class_no_rebind);
   }
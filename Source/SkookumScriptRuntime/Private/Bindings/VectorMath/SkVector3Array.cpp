@@ -0,0 +1,28 @@
+//=======================================================================================
+// SkookumScript C++ library.
+// Copyright (c) 2015 Agog Labs Inc. All rights reserved.
+//
+// SkookumScript array of Vector3 values packed into a contiguous buffer
+//=======================================================================================
+
+//=======================================================================================
+// Includes
+//=======================================================================================
+
+#include "../../SkookumScriptRuntimePrivatePCH.h"
+#include "SkVector3Array.hpp"
+
+//---------------------------------------------------------------------------------------
+void SkVector3Array::register_bindings()
+  {
+  // Common packed array methods
+  SkPackedArray::register_bindings("Vector3Array");
+
+  // Reductions specific to this element type
+  static const SkClass::MethodInitializerFunc methods_i[] =
+    {
+      { "average", mthd_average },
+    };
+
+  ms_class_p->register_method_func_bulk(methods_i, A_COUNT_OF(methods_i), SkBindFlag_instance_no_rebind);
+  }
@@ -0,0 +1,25 @@
+//=======================================================================================
+// SkookumScript C++ library.
+// Copyright (c) 2015 Agog Labs Inc. All rights reserved.
+//
+// SkookumScript array of Vector3 values packed into a contiguous buffer
+//=======================================================================================
+
+#pragma once
+
+//=======================================================================================
+// Includes
+//=======================================================================================
+
+#include "SkPackedArray.hpp"
+#include "SkVector3.hpp"
+
+//---------------------------------------------------------------------------------------
+// SkookumScript array of Vector3 values packed into a contiguous buffer
+class SkVector3Array : public SkPackedArray<SkVector3Array, SkVector3>
+  {
+  public:
+
+    static void register_bindings();
+
+  };
@@ -15,6 +15,7 @@
 #include "SkookumScriptRuntimePrivatePCH.h"
 #include "../Classes/SkookumScriptComponent.h"
 #include "Bindings/SkUEBindings.hpp"
+#include "Bindings/SkUERuntime.hpp"
 #include "SkUEActor.generated.hpp"
 
 
@@ -30,6 +31,7 @@
 //---------------------------------------------------------------------------------------
 USkookumScriptComponent::USkookumScriptComponent(const FObjectInitializer& ObjectInitializer)
   : Super(ObjectInitializer)
+  , m_method_cache_p(nullptr)
   {
   PrimaryComponentTick.bCanEverTick = false;
   bTickInEditor = false;
@@ -99,6 +101,9 @@ void USkookumScriptComponent::OnRegister()
     SkInstance * instance_p = class_p->new_instance();
     instance_p->construct<SkUEActor>(actor_p); // Keep track of owner actor
     m_instance_p = instance_p;
+
+    // Keep class group of demand loaded class around while this instance exists
+    SkUERuntime::get_singleton()->get_class_group_residency()->on_instance_created(instance_p->get_class());
     }
   }
 
@@ -127,13 +132,28 @@ void USkookumScriptComponent::OnUnregister()
   Super::OnUnregister();
 
   //SkDebug::print_ide(a_str_format("USkookumScriptComponent::OnUnregister() 0x%p\n", this), SkLocale_ide, SkDPrintType_trace);
+  SkUERuntime::get_singleton()->get_class_group_residency()->on_instance_destroyed(m_instance_p->get_class());
   m_instance_p->dereference();
+
+  // Forget inline method cache - a new instance is created when registered again
+  delete m_method_cache_p;
+  m_method_cache_p = nullptr;
+  }
+
+//---------------------------------------------------------------------------------------
+void USkookumScriptComponent::BeginDestroy()
+  {
+  delete m_method_cache_p;
+  m_method_cache_p = nullptr;
+
+  Super::BeginDestroy();
   }
 
 //---------------------------------------------------------------------------------------
 void USkookumScriptComponent::invoke_coroutine(FString name)
   {
   //SkDebug::print_ide(a_str_format("USkookumScriptComponent::invoke_coroutine(%S)\n", *name), SkLocale_ide, SkDPrintType_trace);
+  SkUERuntime::get_singleton()->get_class_group_residency()->touch(m_instance_p->get_class());
   m_instance_p->coroutine_call(FStringToASymbol(name), nullptr, false);
   }
 
@@ -141,13 +161,63 @@ void USkookumScriptComponent::invoke_coroutine(FString name)
 void USkookumScriptComponent::invoke_method(FString name)
   {
   //SkDebug::print_ide(a_str_format("USkookumScriptComponent::invoke_method(%S)\n", *name), SkLocale_ide, SkDPrintType_trace);
-  m_instance_p->method_call(FStringToASymbol(name));
+  SkMethodBase * method_p = find_method(name);
+  if (method_p)
+    {
+    invoke_method_direct(method_p, nullptr);
+    }
+  else
+    {
+    // Class method or unknown - let SkookumScript sort it out
+    m_instance_p->method_call(FStringToASymbol(name));
+    }
   }
 
 //---------------------------------------------------------------------------------------
 bool USkookumScriptComponent::invoke_query(FString name)
   {
   //SkDebug::print_ide(a_str_format("USkookumScriptComponent::invoke_query(%S)\n", *name), SkLocale_ide, SkDPrintType_trace);
-  return m_instance_p->method_query(FStringToASymbol(name));
+  SkMethodBase * method_p = find_method(name);
+  if (!method_p)
+    {
+    // Class method or unknown - let SkookumScript sort it out
+    return m_instance_p->method_query(FStringToASymbol(name));
+    }
+
+  SkInstance * result_p = SkBrain::ms_nil_p;
+  invoke_method_direct(method_p, &result_p);
+  bool result = result_p->as<SkBoolean>();
+  result_p->dereference();
+  return result;
+  }
+
+//---------------------------------------------------------------------------------------
+// Find instance method by name - checks the inline cache of this component first
+SkMethodBase * USkookumScriptComponent::find_method(const FString & name)
+  {
+  if (!m_method_cache_p)
+    {
+    m_method_cache_p = new SkUEMethodCache();
+    }
+
+  return m_method_cache_p->find_instance_method(m_instance_p->get_class(), name);
+  }
+
+//---------------------------------------------------------------------------------------
+// Invoke an already resolved instance method without arguments on my instance
+void USkookumScriptComponent::invoke_method_direct(SkMethodBase * method_p, SkInstance ** result_pp)
+  {
+  SkInvokedMethod * imethod_p = SkInvokedMethod::pool_new(nullptr, m_instance_p, method_p);
+
+  SKDEBUG_ICALL_SET_INTERNAL(imethod_p);
+  SKDEBUG_HOOK_SCRIPT_ENTRY(method_p->get_name());
+
+  // No arguments given - fills in defaults if there are any
+  imethod_p->data_append_args(nullptr, 0u, *method_p);
+  method_p->invoke(imethod_p, nullptr, result_pp);
+
+  SKDEBUG_HOOK_SCRIPT_EXIT();
+
+  SkInvokedMethod::pool_delete(imethod_p);
   }
 
@@ -453,6 +453,9 @@ void FSkookumScriptRuntime::OnWorldInitPre(UWorld * world_p, const UWorld::Initi
     {
     // Set global world pointer
     set_game_world(world_p);
+
+    // Start loading class groups this world needed last time
+    m_runtime.get_class_group_residency()->on_world_init(world_p->GetName(), &m_runtime);
     }
   }
 
@@ -495,6 +498,10 @@ void FSkookumScriptRuntime::ShutdownModule()
   {
   A_DPRINT(A_SOURCE_STR " Shutting down SkookumScript plug-in modules\n");
 
+  // Remove Blueprint exports while SkookumScript is still up since they hold on to
+  // SkookumScript objects (parameter lists, cached argument instances)
+  m_blueprint_interface.clear();
+
   //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
   // Clean up SkookumScript
   m_runtime.on_deinit();
@@ -545,6 +552,12 @@ void FSkookumScriptRuntime::Tick(float deltaTime)
     m_remote_client.process_incoming();
   #endif
 
+  // Commit any demand loaded class groups that finished reading in the background
+  m_runtime.update_async_loads();
+
+  // Keep demand loaded class groups within their memory budget
+  m_runtime.get_class_group_residency()->update();
+
   if (m_game_world_p)
     {
     // Intentionally still called even when paused and deltaTime is 0.0f
@@ -566,16 +579,10 @@ TStatId FSkookumScriptRuntime::GetStatId() const
 void FSkookumScriptRuntime::set_game_world(UWorld * world_p)
   {
   m_game_world_p = world_p;
-  SkClass * obj_class_p = SkBrain::get_class(ASymbol_Object);
-  SK_ASSERTX(obj_class_p, "Couldn't find the World class!");
-  uint32_t var_pos;
-  if (obj_class_p->get_class_data().find(ASymbolX_c_world, AMatch_first_found, &var_pos))
-    {
-    obj_class_p->get_class_data().get_at(var_pos)->set_data(world_p ? SkUEWorld::new_instance(world_p) : SkBrain::ms_nil_p);
-    }
-  else
+  SkTypedData * world_var_p = SkUEClassBindingHelper::get_world_var();
+  if (world_var_p)
     {
-    SK_ASSERTX(false, "Couldn't find the @@world class member variable!");
+    world_var_p->set_data(world_p ? SkUEWorld::new_instance(world_p) : SkBrain::ms_nil_p);
     }
   }
 